@@ -29,7 +29,7 @@ void PhysicsExample::PhysicsScene::onInit() {
 
     world = std::make_unique<World>(Point(0.0F, 198.0F));
 
-    TextureManager::load("egg", "assets/egg.png");
+    TextureManager::load("egg", "assets/egg.png", TextureManager::Mipmaps::Auto, TextureManager::PixelRetention::Retain);
     
     auto eggTexture = TextureManager::get("egg");
     if (eggTexture) {
@@ -27,6 +27,8 @@ void ResourceLoaderExample::ResourceLoaderScene::onInit() {
 
 void ResourceLoaderExample::ResourceLoaderScene::onRender() {
     
+    loader.update();
+
     if(loader.isFinished()){
         texture = TextureManager::get("egg");
         texture2 = TextureManager::get("banana");
@@ -1,5 +1,6 @@
 ﻿#include "SpriteAnimationExample.hpp"
 #include "SpriteAnimation.hpp"
+#include "AnimationClipManager.hpp"
 #include "SpriteManager.hpp"
 #include "Window.hpp"
 #include "api/Rect.hpp"
@@ -26,18 +27,19 @@ void SpriteAnimationExample::SpriteAnimationScene::onInit() {
     
     if (sprite) {
         
-        spriteAnimation = std::make_shared<SpriteAnimation>(sprite);
-
-        spriteAnimation->addAnimation("walk", true);
-        spriteAnimation->addFrame("walk", 0, 0.1F);
-        spriteAnimation->addFrame("walk", 1, 0.1F);
-        spriteAnimation->addFrame("walk", 2, 0.1F);
-        spriteAnimation->addFrame("walk", 3, 0.1F);
-
-        spriteAnimation->addAnimation("idle", true);
-        spriteAnimation->addFrame("idle", 4, 0.5F);
-        spriteAnimation->addFrame("idle", 5, 0.5F);
+        AnimationClipManager::create("walk", {
+            { 0.1F, 0 },
+            { 0.1F, 1 },
+            { 0.1F, 2 },
+            { 0.1F, 3 }
+        }, true);
+
+        AnimationClipManager::create("idle", {
+            { 0.5F, 4 },
+            { 0.5F, 5 }
+        }, true);
 
+        spriteAnimation = std::make_shared<SpriteAnimation>(sprite);
         spriteAnimation->setCurrentAnimation("idle");
     }
 }
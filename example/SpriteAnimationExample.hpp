@@ -17,7 +17,6 @@ class SpriteAnimationExample : public Example {
             public:
                 void onInit() override;
                 void onRender() override;
-                void onUpdate() override;
         };
 
     public:
@@ -6,16 +6,24 @@
 
 void TextureExample::TextureScene::onInit() {
     texture = TextureManager::load("id", "path/to/your/texture.png");
+
+    // BC3 with mips, compiled at build time by ez2d_compile_textures and uploaded as-is
+    compressedTexture = TextureManager::load("checker", "assets/checker.ktx");
 }
 
 void TextureExample::TextureScene::onRender() {
     if (texture) {
         Renderer::drawTexture(texture, Rect(100, 100, 200, 200));
     }
+
+    if (compressedTexture) {
+        Renderer::drawTexture(compressedTexture, Rect(400, 100, 200, 200));
+    }
 }
 
 void TextureExample::TextureScene::onExit() {
     TextureManager::unload("id");
+    TextureManager::unload("checker");
 }
 
 void TextureExample::run() {
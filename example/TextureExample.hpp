@@ -11,6 +11,7 @@ class TextureExample : public Example {
 
             private:
                 std::shared_ptr<Texture> texture;
+                std::shared_ptr<Texture> compressedTexture;
 
             public:
                 void onInit() override;
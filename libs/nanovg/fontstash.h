@@ -54,6 +54,12 @@ enum FONSerrorCode {
 	FONS_STATES_UNDERFLOW = 4,
 };
 
+// Distance field glyphs keep this many pixels of spread around the outline at the reference size.
+#define FONS_SDF_PADDING 6
+#define FONS_SDF_ONEDGE 128
+// Change of the stored distance value per pixel of the reference size.
+#define FONS_SDF_DIST_SCALE ((float)FONS_SDF_ONEDGE / FONS_SDF_PADDING)
+
 struct FONSparams {
 	int width, height;
 	unsigned char flags;
@@ -100,11 +106,22 @@ void fonsGetAtlasSize(FONScontext* s, int* width, int* height);
 int fonsExpandAtlas(FONScontext* s, int width, int height);
 // Resets the whole stash.
 int fonsResetAtlas(FONScontext* stash, int width, int height);
+// Serializes the atlas bitmap, skyline and glyph tables. The returned buffer must be freed with free().
+unsigned char* fonsSaveAtlas(FONScontext* stash, int* size);
+// Restores an atlas saved with fonsSaveAtlas(). Glyphs are only restored for fonts added with the same name and data size.
+int fonsLoadAtlas(FONScontext* stash, const unsigned char* data, int size);
 
 // Add fonts
 int fonsAddFont(FONScontext* s, const char* name, const char* path);
 int fonsAddFontMem(FONScontext* s, const char* name, unsigned char* data, int ndata, int freeData);
 int fonsGetFontByName(FONScontext* s, const char* name);
+// Releases a font's data and glyphs. The handle stays reserved and draws nothing.
+void fonsRemoveFont(FONScontext* s, int font);
+// Rasterizes the font's glyphs once as signed distance fields at the reference pixel size and scales
+// them to every requested size. The renderer has to threshold them with a distance field shader.
+int fonsSetFontSDF(FONScontext* s, int font, float referenceSize);
+// Returns the reference pixel size of a distance field font, or 0 for bitmap fonts.
+float fonsGetFontSDF(FONScontext* s, int font);
 
 // State handling
 void fonsPushState(FONScontext* s);
@@ -245,6 +262,20 @@ void fons__tt_renderGlyphBitmap(FONSttFontImpl *font, unsigned char *output, int
 	}
 }
 
+void fons__tt_renderGlyphSDF(FONSttFontImpl *font, unsigned char *output, int outWidth, int outHeight, int outStride,
+							 float scale, int padding, int glyph)
+{
+	// Distance fields are only generated by the stb_truetype backend, fonsSetFontSDF() rejects them here.
+	FONS_NOTUSED(font);
+	FONS_NOTUSED(output);
+	FONS_NOTUSED(outWidth);
+	FONS_NOTUSED(outHeight);
+	FONS_NOTUSED(outStride);
+	FONS_NOTUSED(scale);
+	FONS_NOTUSED(padding);
+	FONS_NOTUSED(glyph);
+}
+
 int fons__tt_getGlyphKernAdvance(FONSttFontImpl *font, int glyph1, int glyph2)
 {
 	FT_Vector ftKerning;
@@ -325,6 +356,22 @@ void fons__tt_renderGlyphBitmap(FONSttFontImpl *font, unsigned char *output, int
 	stbtt_MakeGlyphBitmap(&font->font, output, outWidth, outHeight, outStride, scaleX, scaleY, glyph);
 }
 
+void fons__tt_renderGlyphSDF(FONSttFontImpl *font, unsigned char *output, int outWidth, int outHeight, int outStride,
+							 float scale, int padding, int glyph)
+{
+	int x, y, width, height, xoff, yoff;
+	unsigned char* sdf = stbtt_GetGlyphSDF(&font->font, scale, glyph, padding, FONS_SDF_ONEDGE, FONS_SDF_DIST_SCALE,
+										   &width, &height, &xoff, &yoff);
+	if (sdf == NULL) return;
+
+	for (y = 0; y < height && y < outHeight; y++) {
+		for (x = 0; x < width && x < outWidth; x++) {
+			output[x + y*outStride] = sdf[x + y*width];
+		}
+	}
+	stbtt_FreeSDF(sdf, font->font.userdata);
+}
+
 int fons__tt_getGlyphKernAdvance(FONSttFontImpl *font, int glyph1, int glyph2)
 {
 	return stbtt_GetGlyphKernAdvance(&font->font, glyph1, glyph2);
@@ -357,6 +404,9 @@ int fons__tt_getGlyphKernAdvance(FONSttFontImpl *font, int glyph1, int glyph2)
 #	define FONS_MAX_FALLBACKS 20
 #endif
 
+// Blur value stored in distance field glyphs, keeps them apart from bitmap glyphs of the same size.
+#define FONS_SDF_BLUR -1
+
 static unsigned int fons__hashint(unsigned int a)
 {
 	a += ~(a<<15);
@@ -405,6 +455,7 @@ struct FONSfont
 	int lut[FONS_HASH_LUT_SIZE];
 	int fallbacks[FONS_MAX_FALLBACKS];
 	int nfallbacks;
+	short sdfSize;
 };
 typedef struct FONSfont FONSfont;
 
@@ -799,6 +850,60 @@ int fonsAddFallbackFont(FONScontext* stash, int base, int fallback)
 	return 0;
 }
 
+void fonsRemoveFont(FONScontext* stash, int font)
+{
+	int i, j, n;
+	FONSfont* removed;
+	if (stash == NULL || font < 0 || font >= stash->nfonts) return;
+
+	removed = stash->fonts[font];
+	if (removed->freeData && removed->data) free(removed->data);
+	removed->data = NULL;
+	removed->dataSize = 0;
+	removed->freeData = 0;
+	removed->name[0] = '\0';
+	removed->nglyphs = 0;
+	removed->nfallbacks = 0;
+	removed->sdfSize = 0;
+	for (i = 0; i < FONS_HASH_LUT_SIZE; ++i)
+		removed->lut[i] = -1;
+
+	for (i = 0; i < stash->nfonts; ++i) {
+		FONSfont* other = stash->fonts[i];
+		n = 0;
+		for (j = 0; j < other->nfallbacks; ++j) {
+			if (other->fallbacks[j] != font)
+				other->fallbacks[n++] = other->fallbacks[j];
+		}
+		other->nfallbacks = n;
+	}
+}
+
+int fonsSetFontSDF(FONScontext* stash, int font, float referenceSize)
+{
+#ifdef FONS_USE_FREETYPE
+	FONS_NOTUSED(stash);
+	FONS_NOTUSED(font);
+	FONS_NOTUSED(referenceSize);
+	return 0;
+#else
+	FONSfont* target;
+	if (stash == NULL || font < 0 || font >= stash->nfonts) return 0;
+	target = stash->fonts[font];
+	if (target->data == NULL) return 0;
+
+	if (referenceSize > 3000.0f) referenceSize = 3000.0f;
+	target->sdfSize = referenceSize >= 1.0f ? (short)(referenceSize*10.0f) : 0;
+	return 1;
+#endif
+}
+
+float fonsGetFontSDF(FONScontext* stash, int font)
+{
+	if (stash == NULL || font < 0 || font >= stash->nfonts) return 0.0f;
+	return stash->fonts[font]->sdfSize / 10.0f;
+}
+
 void fonsSetSize(FONScontext* stash, float size)
 {
 	fons__getState(stash)->size = size;
@@ -1070,8 +1175,16 @@ static FONSglyph* fons__getGlyph(FONScontext* stash, FONSfont* font, unsigned in
 	FONSfont* renderFont = font;
 
 	if (isize < 2) return NULL;
-	if (iblur > 20) iblur = 20;
-	pad = iblur+2;
+	if (font->sdfSize > 0) {
+		// Distance field glyphs are rasterized once at the reference size, the quad scales them.
+		isize = font->sdfSize;
+		iblur = FONS_SDF_BLUR;
+		pad = FONS_SDF_PADDING;
+		size = isize/10.0f;
+	} else {
+		if (iblur > 20) iblur = 20;
+		pad = iblur+2;
+	}
 
 	// Reset allocator.
 	stash->nscratch = 0;
@@ -1154,8 +1267,14 @@ static FONSglyph* fons__getGlyph(FONScontext* stash, FONSfont* font, unsigned in
 	}
 
 	// Rasterize
-	dst = &stash->texData[(glyph->x0+pad) + (glyph->y0+pad) * stash->params.width];
-	fons__tt_renderGlyphBitmap(&renderFont->font, dst, gw-pad*2,gh-pad*2, stash->params.width, scale, scale, g);
+	if (font->sdfSize > 0) {
+		// The distance field covers the padding as well.
+		dst = &stash->texData[glyph->x0 + glyph->y0 * stash->params.width];
+		fons__tt_renderGlyphSDF(&renderFont->font, dst, gw, gh, stash->params.width, scale, pad, g);
+	} else {
+		dst = &stash->texData[(glyph->x0+pad) + (glyph->y0+pad) * stash->params.width];
+		fons__tt_renderGlyphBitmap(&renderFont->font, dst, gw-pad*2,gh-pad*2, stash->params.width, scale, scale, g);
+	}
 
 	// Make sure there is one pixel empty border.
 	dst = &stash->texData[glyph->x0 + glyph->y0 * stash->params.width];
@@ -1194,10 +1313,12 @@ static FONSglyph* fons__getGlyph(FONScontext* stash, FONSfont* font, unsigned in
 }
 
 static void fons__getQuad(FONScontext* stash, FONSfont* font,
-						   int prevGlyphIndex, FONSglyph* glyph,
+						   int prevGlyphIndex, FONSglyph* glyph, short isize,
 						   float scale, float spacing, float* x, float* y, FONSquad* q)
 {
 	float rx,ry,xoff,yoff,x0,y0,x1,y1;
+	// Distance field glyphs are stored at the reference size, size them to the requested one.
+	float k = (float)isize / (float)glyph->size;
 
 	if (prevGlyphIndex != -1) {
 		float adv = fons__tt_getGlyphKernAdvance(&font->font, prevGlyphIndex, glyph->index) * scale;
@@ -1207,8 +1328,8 @@ static void fons__getQuad(FONScontext* stash, FONSfont* font,
 	// Each glyph has 2px border to allow good interpolation,
 	// one pixel to prevent leaking, and one to allow good interpolation for rendering.
 	// Inset the texture region by one pixel for correct interpolation.
-	xoff = (short)(glyph->xoff+1);
-	yoff = (short)(glyph->yoff+1);
+	xoff = (glyph->xoff+1) * k;
+	yoff = (glyph->yoff+1) * k;
 	x0 = (float)(glyph->x0+1);
 	y0 = (float)(glyph->y0+1);
 	x1 = (float)(glyph->x1-1);
@@ -1220,8 +1341,8 @@ static void fons__getQuad(FONScontext* stash, FONSfont* font,
 
 		q->x0 = rx;
 		q->y0 = ry;
-		q->x1 = rx + x1 - x0;
-		q->y1 = ry + y1 - y0;
+		q->x1 = rx + (x1 - x0) * k;
+		q->y1 = ry + (y1 - y0) * k;
 
 		q->s0 = x0 * stash->itw;
 		q->t0 = y0 * stash->ith;
@@ -1233,8 +1354,8 @@ static void fons__getQuad(FONScontext* stash, FONSfont* font,
 
 		q->x0 = rx;
 		q->y0 = ry;
-		q->x1 = rx + x1 - x0;
-		q->y1 = ry - y1 + y0;
+		q->x1 = rx + (x1 - x0) * k;
+		q->y1 = ry - (y1 - y0) * k;
 
 		q->s0 = x0 * stash->itw;
 		q->t0 = y0 * stash->ith;
@@ -1242,7 +1363,7 @@ static void fons__getQuad(FONScontext* stash, FONSfont* font,
 		q->t1 = y1 * stash->ith;
 	}
 
-	*x += (int)(glyph->xadv / 10.0f + 0.5f);
+	*x += (int)(glyph->xadv * k / 10.0f + 0.5f);
 }
 
 static void fons__flush(FONScontext* stash)
@@ -1346,7 +1467,7 @@ float fonsDrawText(FONScontext* stash,
 			continue;
 		glyph = fons__getGlyph(stash, font, codepoint, isize, iblur, FONS_GLYPH_BITMAP_REQUIRED);
 		if (glyph != NULL) {
-			fons__getQuad(stash, font, prevGlyphIndex, glyph, scale, state->spacing, &x, &y, &q);
+			fons__getQuad(stash, font, prevGlyphIndex, glyph, isize, scale, state->spacing, &x, &y, &q);
 
 			if (stash->nverts+6 > FONS_VERTEX_COUNT)
 				fons__flush(stash);
@@ -1431,7 +1552,7 @@ int fonsTextIterNext(FONScontext* stash, FONStextIter* iter, FONSquad* quad)
 		glyph = fons__getGlyph(stash, iter->font, iter->codepoint, iter->isize, iter->iblur, iter->bitmapOption);
 		// If the iterator was initialized with FONS_GLYPH_BITMAP_OPTIONAL, then the UV coordinates of the quad will be invalid.
 		if (glyph != NULL)
-			fons__getQuad(stash, iter->font, iter->prevGlyphIndex, glyph, iter->scale, iter->spacing, &iter->nextx, &iter->nexty, quad);
+			fons__getQuad(stash, iter->font, iter->prevGlyphIndex, glyph, iter->isize, iter->scale, iter->spacing, &iter->nextx, &iter->nexty, quad);
 		iter->prevGlyphIndex = glyph != NULL ? glyph->index : -1;
 		break;
 	}
@@ -1528,7 +1649,7 @@ float fonsTextBounds(FONScontext* stash,
 			continue;
 		glyph = fons__getGlyph(stash, font, codepoint, isize, iblur, FONS_GLYPH_BITMAP_OPTIONAL);
 		if (glyph != NULL) {
-			fons__getQuad(stash, font, prevGlyphIndex, glyph, scale, state->spacing, &x, &y, &q);
+			fons__getQuad(stash, font, prevGlyphIndex, glyph, isize, scale, state->spacing, &x, &y, &q);
 			if (q.x0 < minx) minx = q.x0;
 			if (q.x1 > maxx) maxx = q.x1;
 			if (stash->params.flags & FONS_ZERO_TOPLEFT) {
@@ -1772,4 +1893,164 @@ int fonsResetAtlas(FONScontext* stash, int width, int height)
 }
 
 
+#define FONS_ATLAS_MAGIC 0x31415346 // "FSA1"
+
+static void fons__writeBytes(unsigned char** ptr, const void* data, int size)
+{
+	memcpy(*ptr, data, size);
+	*ptr += size;
+}
+
+static int fons__readBytes(const unsigned char** ptr, const unsigned char* end, void* data, int size)
+{
+	if (size < 0 || end - *ptr < size) return 0;
+	memcpy(data, *ptr, size);
+	*ptr += size;
+	return 1;
+}
+
+unsigned char* fonsSaveAtlas(FONScontext* stash, int* size)
+{
+	int i, magic = FONS_ATLAS_MAGIC;
+	int total;
+	unsigned char* data;
+	unsigned char* ptr;
+	FONSatlas* atlas;
+
+	if (stash == NULL || size == NULL) return NULL;
+	atlas = stash->atlas;
+
+	// Flush pending glyphs.
+	fons__flush(stash);
+
+	total = sizeof(int)*5 + sizeof(FONSatlasNode)*atlas->nnodes + atlas->width*atlas->height;
+	for (i = 0; i < stash->nfonts; i++)
+		total += sizeof(stash->fonts[i]->name) + sizeof(int)*2 + sizeof(FONSglyph)*stash->fonts[i]->nglyphs;
+
+	data = (unsigned char*)malloc(total);
+	if (data == NULL) return NULL;
+
+	ptr = data;
+	fons__writeBytes(&ptr, &magic, sizeof(int));
+	fons__writeBytes(&ptr, &atlas->width, sizeof(int));
+	fons__writeBytes(&ptr, &atlas->height, sizeof(int));
+	fons__writeBytes(&ptr, &atlas->nnodes, sizeof(int));
+	fons__writeBytes(&ptr, atlas->nodes, sizeof(FONSatlasNode)*atlas->nnodes);
+	fons__writeBytes(&ptr, stash->texData, atlas->width*atlas->height);
+	fons__writeBytes(&ptr, &stash->nfonts, sizeof(int));
+	for (i = 0; i < stash->nfonts; i++) {
+		FONSfont* font = stash->fonts[i];
+		fons__writeBytes(&ptr, font->name, sizeof(font->name));
+		fons__writeBytes(&ptr, &font->dataSize, sizeof(int));
+		fons__writeBytes(&ptr, &font->nglyphs, sizeof(int));
+		fons__writeBytes(&ptr, font->glyphs, sizeof(FONSglyph)*font->nglyphs);
+	}
+
+	*size = total;
+	return data;
+}
+
+int fonsLoadAtlas(FONScontext* stash, const unsigned char* data, int size)
+{
+	int i, j, magic, width, height, nnodes, nfonts;
+	const unsigned char* ptr = data;
+	const unsigned char* end = data + size;
+	FONSatlas* atlas;
+	FONSatlasNode* nodes;
+	unsigned char* texData;
+
+	if (stash == NULL || data == NULL) return 0;
+	atlas = stash->atlas;
+
+	if (!fons__readBytes(&ptr, end, &magic, sizeof(int)) || magic != FONS_ATLAS_MAGIC) return 0;
+	if (!fons__readBytes(&ptr, end, &width, sizeof(int))) return 0;
+	if (!fons__readBytes(&ptr, end, &height, sizeof(int))) return 0;
+	if (!fons__readBytes(&ptr, end, &nnodes, sizeof(int))) return 0;
+	if (width <= 0 || height <= 0 || nnodes <= 0) return 0;
+	if (end - ptr < (long)sizeof(FONSatlasNode)*nnodes + (long)width*height) return 0;
+
+	// Flush pending glyphs.
+	fons__flush(stash);
+
+	if (stash->params.renderResize != NULL && (width != stash->params.width || height != stash->params.height)) {
+		if (stash->params.renderResize(stash->params.userPtr, width, height) == 0)
+			return 0;
+	}
+
+	// Restore skyline.
+	if (nnodes > atlas->cnodes) {
+		nodes = (FONSatlasNode*)realloc(atlas->nodes, sizeof(FONSatlasNode)*nnodes);
+		if (nodes == NULL) return 0;
+		atlas->nodes = nodes;
+		atlas->cnodes = nnodes;
+	}
+	fons__readBytes(&ptr, end, atlas->nodes, sizeof(FONSatlasNode)*nnodes);
+	atlas->nnodes = nnodes;
+	atlas->width = width;
+	atlas->height = height;
+
+	// Restore texture data.
+	texData = (unsigned char*)realloc(stash->texData, width * height);
+	if (texData == NULL) return 0;
+	stash->texData = texData;
+	fons__readBytes(&ptr, end, stash->texData, width * height);
+
+	stash->params.width = width;
+	stash->params.height = height;
+	stash->itw = 1.0f/stash->params.width;
+	stash->ith = 1.0f/stash->params.height;
+
+	// Whole texture needs to be uploaded.
+	stash->dirtyRect[0] = 0;
+	stash->dirtyRect[1] = 0;
+	stash->dirtyRect[2] = width;
+	stash->dirtyRect[3] = height;
+
+	// Reset cached glyphs, they refer to the previous atlas.
+	for (i = 0; i < stash->nfonts; i++) {
+		FONSfont* font = stash->fonts[i];
+		font->nglyphs = 0;
+		for (j = 0; j < FONS_HASH_LUT_SIZE; j++)
+			font->lut[j] = -1;
+	}
+
+	// Restore glyph tables of the fonts that are loaded.
+	if (!fons__readBytes(&ptr, end, &nfonts, sizeof(int))) return 1;
+	for (i = 0; i < nfonts; i++) {
+		char name[64];
+		int dataSize, nglyphs, idx;
+		FONSfont* font = NULL;
+
+		if (!fons__readBytes(&ptr, end, name, sizeof(name))) break;
+		if (!fons__readBytes(&ptr, end, &dataSize, sizeof(int))) break;
+		if (!fons__readBytes(&ptr, end, &nglyphs, sizeof(int))) break;
+		if (nglyphs < 0 || end - ptr < (long)sizeof(FONSglyph)*nglyphs) break;
+
+		name[sizeof(name)-1] = '\0';
+		idx = fonsGetFontByName(stash, name);
+		if (idx != FONS_INVALID && stash->fonts[idx]->data != NULL && stash->fonts[idx]->dataSize == dataSize)
+			font = stash->fonts[idx];
+
+		for (j = 0; j < nglyphs; j++) {
+			FONSglyph src;
+			FONSglyph* glyph;
+			unsigned int h;
+
+			fons__readBytes(&ptr, end, &src, sizeof(FONSglyph));
+			if (font == NULL) continue;
+
+			glyph = fons__allocGlyph(font);
+			if (glyph == NULL) return 0;
+			*glyph = src;
+
+			// Insert char to hash lookup.
+			h = fons__hashint(glyph->codepoint) & (FONS_HASH_LUT_SIZE-1);
+			glyph->next = font->lut[h];
+			font->lut[h] = font->nglyphs-1;
+		}
+	}
+
+	return 1;
+}
+
 #endif
@@ -0,0 +1,29 @@
+$input v_position, v_texcoord0, v_color0
+
+#include <bgfx_shader.sh>
+
+uniform mat3 u_scissorMat;
+uniform vec4 u_scissorExtScale;
+uniform vec4 u_params;
+
+SAMPLER2D(s_tex, 0);
+
+#define u_scissorExt   (u_scissorExtScale.xy)
+#define u_scissorScale (u_scissorExtScale.zw)
+#define u_texType      (u_params.z)
+
+// Scissoring
+float scissorMask(vec2 p)
+{
+	vec2 sc = abs(mul(u_scissorMat, vec3(p, 1.0) ).xy) - u_scissorExt;
+	sc = vec2(0.5, 0.5) - sc * u_scissorScale;
+	return clamp(sc.x, 0.0, 1.0) * clamp(sc.y, 0.0, 1.0);
+}
+
+void main()
+{
+	vec4 color = texture2D(s_tex, v_texcoord0.xy);
+	if (u_texType == 1.0) color = vec4(color.xyz * color.w, color.w);
+	if (u_texType == 2.0) color = color.xxxx;
+	gl_FragColor = color * v_color0 * scissorMask(v_position);
+}
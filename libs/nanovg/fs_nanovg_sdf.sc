@@ -0,0 +1,30 @@
+$input v_position, v_texcoord0
+
+#include <bgfx_shader.sh>
+
+uniform mat3 u_scissorMat;
+uniform vec4 u_innerCol;
+uniform vec4 u_scissorExtScale;
+uniform vec4 u_params;
+
+SAMPLER2D(s_tex, 0);
+
+#define u_scissorExt   (u_scissorExtScale.xy)
+#define u_scissorScale (u_scissorExtScale.zw)
+#define u_smoothing    (u_params.x)
+
+// Scissoring
+float scissorMask(vec2 p)
+{
+	vec2 sc = abs(mul(u_scissorMat, vec3(p, 1.0) ).xy) - u_scissorExt;
+	sc = vec2(0.5, 0.5) - sc * u_scissorScale;
+	return clamp(sc.x, 0.0, 1.0) * clamp(sc.y, 0.0, 1.0);
+}
+
+void main()
+{
+	// The glyph outline sits at 0.5, smoothing is half a screen pixel in distance units.
+	float distance = texture2D(s_tex, v_texcoord0.xy).x;
+	float alpha = smoothstep(0.5 - u_smoothing, 0.5 + u_smoothing, distance);
+	gl_FragColor = u_innerCol * (alpha * scissorMask(v_position) );
+}
@@ -53,6 +53,7 @@ BX_PRAGMA_DIAGNOSTIC_POP();
 #define NVG_INIT_PATHS_SIZE 16
 #define NVG_INIT_VERTS_SIZE 256
 #define NVG_MAX_STATES 32
+#define NVG_MAX_TRIANGLE_VERTS 65535	// Backend indices are 16-bit, a multiple of 3 keeps triangles whole.
 
 #define NVG_KAPPA90 0.5522847493f	// Length proportional to radius of a cubic bezier handle for 90deg arcs.
 
@@ -135,6 +136,8 @@ struct NVGcontext {
 	struct FONScontext* fs;
 	int fontImages[NVG_MAX_FONTIMAGES];
 	int fontImageIdx;
+	int fontAtlasGeneration;
+	int textScaleSteps;
 	int drawCallCount;
 	int fillTriCount;
 	int strokeTriCount;
@@ -2267,6 +2270,245 @@ void nvgStroke(NVGcontext* ctx)
 	}
 }
 
+struct NVGshape {
+	NVGvertex* verts;
+	int nverts;
+	NVGpath* paths;
+	NVGpath* drawPaths;
+	int npaths;
+};
+
+static NVGshape* nvg__createShape(NVGcontext* ctx)
+{
+	NVGstate* state = nvg__getState(ctx);
+	NVGpathCache* cache = ctx->cache;
+	NVGshape* shape;
+	NVGvertex* dst;
+	int i, nverts = 0, expanded;
+
+	nvg__flattenPaths(ctx);
+	if (ctx->params.edgeAntiAlias && state->shapeAntiAlias)
+		expanded = nvg__expandFill(ctx, ctx->fringeWidth, NVG_MITER, 2.4f);
+	else
+		expanded = nvg__expandFill(ctx, 0.0f, NVG_MITER, 2.4f);
+
+	if (expanded == 0 || cache->npaths == 0) return NULL;
+
+	for (i = 0; i < cache->npaths; i++)
+		nverts += cache->paths[i].nfill + cache->paths[i].nstroke;
+
+	shape = (NVGshape*)malloc(sizeof(NVGshape));
+	if (shape == NULL) return NULL;
+	memset(shape, 0, sizeof(NVGshape));
+
+	shape->verts = (NVGvertex*)malloc(sizeof(NVGvertex)*nvg__maxi(nverts, 1));
+	if (shape->verts == NULL) goto error;
+	shape->paths = (NVGpath*)malloc(sizeof(NVGpath)*cache->npaths);
+	if (shape->paths == NULL) goto error;
+	shape->drawPaths = (NVGpath*)malloc(sizeof(NVGpath)*cache->npaths);
+	if (shape->drawPaths == NULL) goto error;
+
+	// Copy the expanded vertices, the path pointers point to the shape's own vertex storage.
+	dst = shape->verts;
+	for (i = 0; i < cache->npaths; i++) {
+		const NVGpath* src = &cache->paths[i];
+		NVGpath* path = &shape->paths[i];
+		*path = *src;
+		path->fill = NULL;
+		path->stroke = NULL;
+		if (src->nfill > 0) {
+			memcpy(dst, src->fill, sizeof(NVGvertex)*src->nfill);
+			path->fill = dst;
+			dst += src->nfill;
+		}
+		if (src->nstroke > 0) {
+			memcpy(dst, src->stroke, sizeof(NVGvertex)*src->nstroke);
+			path->stroke = dst;
+			dst += src->nstroke;
+		}
+	}
+	shape->nverts = nverts;
+	shape->npaths = cache->npaths;
+
+	return shape;
+
+error:
+	nvgDeleteShape(ctx, shape);
+	return NULL;
+}
+
+NVGshape* nvgCreateShape(NVGcontext* ctx)
+{
+	return nvgCreateShapeScaled(ctx, 1.0f);
+}
+
+NVGshape* nvgCreateShapeScaled(NVGcontext* ctx, float scale)
+{
+	float ratio = ctx->devicePxRatio;
+	NVGshape* shape;
+
+	// Tessellation tolerance and fringe width follow the pixel size the shape is drawn at.
+	nvg__setDevicePixelRatio(ctx, ratio * nvg__maxf(scale, 0.001f));
+	shape = nvg__createShape(ctx);
+	nvg__setDevicePixelRatio(ctx, ratio);
+	return shape;
+}
+
+void nvgFillShape(NVGcontext* ctx, NVGshape* shape, float x, float y)
+{
+	NVGstate* state = nvg__getState(ctx);
+	NVGpaint fillPaint = state->fill;
+	const NVGpath* path;
+	NVGvertex* verts;
+	float bounds[4];
+	int i;
+
+	if (shape == NULL || shape->nverts == 0) return;
+
+	// The path cache vertices are rebuilt by every fill and stroke, so they can be reused here.
+	verts = nvg__allocTempVerts(ctx, shape->nverts);
+	if (verts == NULL) return;
+
+	bounds[0] = bounds[1] = 1e6f;
+	bounds[2] = bounds[3] = -1e6f;
+
+	for (i = 0; i < shape->nverts; i++) {
+		const NVGvertex* src = &shape->verts[i];
+		nvgTransformPoint(&verts[i].x, &verts[i].y, state->xform, src->x + x, src->y + y);
+		verts[i].u = src->u;
+		verts[i].v = src->v;
+		bounds[0] = nvg__minf(bounds[0], verts[i].x);
+		bounds[1] = nvg__minf(bounds[1], verts[i].y);
+		bounds[2] = nvg__maxf(bounds[2], verts[i].x);
+		bounds[3] = nvg__maxf(bounds[3], verts[i].y);
+	}
+
+	for (i = 0; i < shape->npaths; i++) {
+		shape->drawPaths[i] = shape->paths[i];
+		if (shape->paths[i].fill != NULL)
+			shape->drawPaths[i].fill = verts + (shape->paths[i].fill - shape->verts);
+		if (shape->paths[i].stroke != NULL)
+			shape->drawPaths[i].stroke = verts + (shape->paths[i].stroke - shape->verts);
+	}
+
+	// Apply global alpha
+	fillPaint.innerColor.a *= state->alpha;
+	fillPaint.outerColor.a *= state->alpha;
+
+	ctx->params.renderFill(ctx->params.userPtr, &fillPaint, state->compositeOperation, &state->scissor, ctx->fringeWidth,
+						   bounds, shape->drawPaths, shape->npaths);
+
+	// Count triangles
+	for (i = 0; i < shape->npaths; i++) {
+		path = &shape->drawPaths[i];
+		ctx->fillTriCount += path->nfill-2;
+		ctx->fillTriCount += path->nstroke-2;
+		ctx->drawCallCount += 2;
+	}
+}
+
+void nvgDeleteShape(NVGcontext* ctx, NVGshape* shape)
+{
+	NVG_NOTUSED(ctx);
+	if (shape == NULL) return;
+	if (shape->verts != NULL) free(shape->verts);
+	if (shape->paths != NULL) free(shape->paths);
+	if (shape->drawPaths != NULL) free(shape->drawPaths);
+	free(shape);
+}
+
+void nvgTriangles(NVGcontext* ctx, int image, const float* verts, int nverts)
+{
+	NVGstate* state = nvg__getState(ctx);
+	NVGpaint paint;
+	NVGvertex* dst;
+	int i, first, count;
+
+	if (verts == NULL || image == 0 || nverts < 3) return;
+	nverts -= nverts % 3;
+
+	nvg__setPaintColor(&paint, state->fill.innerColor);
+	paint.image = image;
+
+	// Apply global alpha
+	paint.innerColor.a *= state->alpha;
+	paint.outerColor.a *= state->alpha;
+
+	// Each call must fit the backend's 16-bit vertex range, so large batches are split.
+	for (first = 0; first < nverts; first += count) {
+		count = nvg__mini(nverts - first, NVG_MAX_TRIANGLE_VERTS);
+
+		dst = nvg__allocTempVerts(ctx, count);
+		if (dst == NULL) return;
+
+		for (i = 0; i < count; i++) {
+			const float* src = &verts[(first + i)*4];
+			nvgTransformPoint(&dst[i].x, &dst[i].y, state->xform, src[0], src[1]);
+			dst[i].u = src[2];
+			dst[i].v = src[3];
+		}
+
+		ctx->params.renderTriangles(ctx->params.userPtr, &paint, state->compositeOperation, &state->scissor, dst, count);
+
+		ctx->drawCallCount++;
+		ctx->fillTriCount += count/3;
+	}
+}
+
+void nvgQuads(NVGcontext* ctx, int image, const float* instances, int count, float startSize, float endSize, NVGcolor endColor)
+{
+	NVGstate* state = nvg__getState(ctx);
+	NVGpaint paint;
+
+	if (instances == NULL || image == 0 || count <= 0 || ctx->params.renderQuads == NULL) return;
+
+	// Quads fade from the fill color (inner) to endColor (outer).
+	nvg__setPaintColor(&paint, state->fill.innerColor);
+	paint.outerColor = endColor;
+	paint.image = image;
+
+	// Apply global alpha
+	paint.innerColor.a *= state->alpha;
+	paint.outerColor.a *= state->alpha;
+
+	ctx->params.renderQuads(ctx->params.userPtr, &paint, state->compositeOperation, &state->scissor, state->xform, instances, count, startSize, endSize);
+
+	ctx->drawCallCount++;
+	ctx->fillTriCount += count*2;
+}
+
+int nvgCreateTriangleBuffer(NVGcontext* ctx, const float* verts, int nverts)
+{
+	if (verts == NULL || nverts < 3 || ctx->params.renderCreateBuffer == NULL) return 0;
+	nverts -= nverts % 3;
+	return ctx->params.renderCreateBuffer(ctx->params.userPtr, (const NVGvertex*)verts, nverts);
+}
+
+void nvgTriangleBuffer(NVGcontext* ctx, int buffer, int image)
+{
+	NVGstate* state = nvg__getState(ctx);
+	NVGpaint paint;
+
+	if (buffer == 0 || image == 0 || ctx->params.renderBufferTriangles == NULL) return;
+
+	nvg__setPaintColor(&paint, state->fill.innerColor);
+	paint.image = image;
+
+	// Apply global alpha
+	paint.innerColor.a *= state->alpha;
+	paint.outerColor.a *= state->alpha;
+
+	ctx->params.renderBufferTriangles(ctx->params.userPtr, &paint, state->compositeOperation, &state->scissor, state->xform, buffer);
+
+	ctx->drawCallCount++;
+}
+
+void nvgDeleteTriangleBuffer(NVGcontext* ctx, int buffer)
+{
+	if (buffer == 0 || ctx->params.renderDeleteBuffer == NULL) return;
+	ctx->params.renderDeleteBuffer(ctx->params.userPtr, buffer);
+}
+
 // Add fonts
 int nvgCreateFont(NVGcontext* ctx, const char* name, const char* path)
 {
@@ -2278,6 +2520,11 @@ int nvgCreateFontMem(NVGcontext* ctx, const char* name, unsigned char* data, int
 	return fonsAddFontMem(ctx->fs, name, data, ndata, freeData);
 }
 
+void nvgDeleteFont(NVGcontext* ctx, int font)
+{
+	fonsRemoveFont(ctx->fs, font);
+}
+
 int nvgFindFont(NVGcontext* ctx, const char* name)
 {
 	if (name == NULL) return -1;
@@ -2285,6 +2532,15 @@ int nvgFindFont(NVGcontext* ctx, const char* name)
 }
 
 
+int nvgFontSDF(NVGcontext* ctx, int font, float referenceSize)
+{
+	if (font == -1 || ctx->params.renderSdfTriangles == NULL) return 0;
+	if (!fonsSetFontSDF(ctx->fs, font, referenceSize)) return 0;
+	// Text runs built from the previous glyphs are stale.
+	++ctx->fontAtlasGeneration;
+	return 1;
+}
+
 int nvgAddFallbackFontId(NVGcontext* ctx, int baseFont, int fallbackFont)
 {
 	if(baseFont == -1 || fallbackFont == -1) return 0;
@@ -2327,6 +2583,19 @@ void nvgTextAlign(NVGcontext* ctx, int align)
 	state->textAlign = align;
 }
 
+float nvgDevicePixelRatio(NVGcontext* ctx, float ratio)
+{
+	float previous = ctx->devicePxRatio;
+	if (ratio > 0.0f)
+		nvg__setDevicePixelRatio(ctx, ratio);
+	return previous;
+}
+
+void nvgTextScaleQuantization(NVGcontext* ctx, int stepsPerOctave)
+{
+	ctx->textScaleSteps = nvg__maxi(stepsPerOctave, 0);
+}
+
 void nvgFontFaceId(NVGcontext* ctx, int font)
 {
 	NVGstate* state = nvg__getState(ctx);
@@ -2349,6 +2618,19 @@ static float nvg__getFontScale(NVGstate* state)
 	return nvg__minf(nvg__quantize(nvg__getAverageScale(state->xform), 0.01f), 4.0f);
 }
 
+// Returns the scale glyphs are rasterized at. With scale quantization enabled the transform
+// scale snaps to a fixed number of steps per octave, so zooming text reuses a small set of
+// rasterized sizes instead of creating new atlas entries for every intermediate scale.
+static float nvg__getTextScale(NVGcontext* ctx, NVGstate* state)
+{
+	float scale = nvg__getFontScale(state);
+	if (ctx->textScaleSteps > 0 && scale > 0.0f) {
+		float steps = (float)ctx->textScaleSteps;
+		scale = nvg__minf(powf(2.0f, floorf(log2f(scale) * steps + 0.5f) / steps), 4.0f);
+	}
+	return scale * ctx->devicePxRatio;
+}
+
 static void nvg__flushTextTexture(NVGcontext* ctx)
 {
 	int dirty[4];
@@ -2388,14 +2670,16 @@ static int nvg__allocTextAtlas(NVGcontext* ctx)
 		ctx->fontImages[ctx->fontImageIdx+1] = ctx->params.renderCreateTexture(ctx->params.userPtr, NVG_TEXTURE_ALPHA, iw, ih, 0, NULL);
 	}
 	++ctx->fontImageIdx;
+	++ctx->fontAtlasGeneration;
 	fonsResetAtlas(ctx->fs, iw, ih);
 	return 1;
 }
 
-static void nvg__renderText(NVGcontext* ctx, NVGvertex* verts, int nverts)
+static void nvg__renderText(NVGcontext* ctx, NVGvertex* verts, int nverts, int fontId, float fontSize)
 {
 	NVGstate* state = nvg__getState(ctx);
 	NVGpaint paint = state->fill;
+	float sdfSize = fonsGetFontSDF(ctx->fs, fontId);
 
 	// Render triangles.
 	paint.image = ctx->fontImages[ctx->fontImageIdx];
@@ -2404,19 +2688,50 @@ static void nvg__renderText(NVGcontext* ctx, NVGvertex* verts, int nverts)
 	paint.innerColor.a *= state->alpha;
 	paint.outerColor.a *= state->alpha;
 
-	ctx->params.renderTriangles(ctx->params.userPtr, &paint, state->compositeOperation, &state->scissor, verts, nverts);
+	if (sdfSize > 0.0f) {
+		// Half a screen pixel expressed in distance field units at the displayed size.
+		float size = nvg__maxf(fontSize * nvg__getAverageScale(state->xform) * ctx->devicePxRatio, 1.0f);
+		float smoothing = nvg__minf(0.5f * FONS_SDF_DIST_SCALE / 255.0f * sdfSize / size, 0.5f);
+		ctx->params.renderSdfTriangles(ctx->params.userPtr, &paint, state->compositeOperation, &state->scissor, verts, nverts, smoothing);
+	} else {
+		ctx->params.renderTriangles(ctx->params.userPtr, &paint, state->compositeOperation, &state->scissor, verts, nverts);
+	}
 
 	ctx->drawCallCount++;
 	ctx->textTriCount += nverts/3;
 }
 
+unsigned char* nvgSaveFontAtlas(NVGcontext* ctx, int* ndata)
+{
+	return fonsSaveAtlas(ctx->fs, ndata);
+}
+
+int nvgLoadFontAtlas(NVGcontext* ctx, const unsigned char* data, int ndata)
+{
+	int iw, ih, width, height;
+
+	if (!fonsLoadAtlas(ctx->fs, data, ndata)) return 0;
+
+	// The restored atlas replaces the current font image.
+	fonsGetAtlasSize(ctx->fs, &width, &height);
+	nvgImageSize(ctx, ctx->fontImages[ctx->fontImageIdx], &iw, &ih);
+	if (iw != width || ih != height) {
+		nvgDeleteImage(ctx, ctx->fontImages[ctx->fontImageIdx]);
+		ctx->fontImages[ctx->fontImageIdx] = ctx->params.renderCreateTexture(ctx->params.userPtr, NVG_TEXTURE_ALPHA, width, height, 0, NULL);
+	}
+	++ctx->fontAtlasGeneration;
+
+	nvg__flushTextTexture(ctx);
+	return 1;
+}
+
 float nvgText(NVGcontext* ctx, float x, float y, const char* string, const char* end)
 {
 	NVGstate* state = nvg__getState(ctx);
 	FONStextIter iter, prevIter;
 	FONSquad q;
 	NVGvertex* verts;
-	float scale = nvg__getFontScale(state) * ctx->devicePxRatio;
+	float scale = nvg__getTextScale(ctx, state);
 	float invscale = 1.0f / scale;
 	int cverts = 0;
 	int nverts = 0;
@@ -2442,7 +2757,7 @@ float nvgText(NVGcontext* ctx, float x, float y, const char* string, const char*
 		float c[4*2];
 		if (iter.prevGlyphIndex == -1) { // can not retrieve glyph?
 			if (nverts != 0) {
-				nvg__renderText(ctx, verts, nverts);
+				nvg__renderText(ctx, verts, nverts, state->fontId, state->fontSize);
 				nverts = 0;
 			}
 			if (!nvg__allocTextAtlas(ctx))
@@ -2472,11 +2787,189 @@ float nvgText(NVGcontext* ctx, float x, float y, const char* string, const char*
 	// TODO: add back-end bit to do this just once per frame.
 	nvg__flushTextTexture(ctx);
 
-	nvg__renderText(ctx, verts, nverts);
+	nvg__renderText(ctx, verts, nverts, state->fontId, state->fontSize);
 
 	return iter.nextx / scale;
 }
 
+struct NVGtextRun {
+	float* quads;
+	int nquads;
+	float scale;
+	int fontId;
+	float fontSize;
+	int generation;
+	float advance;
+	float bounds[4];
+	float ascender;
+	float descender;
+	float lineh;
+};
+
+static int nvg__buildTextRun(NVGcontext* ctx, NVGtextRun* run, const char* string, const char* end)
+{
+	FONStextIter iter, prevIter;
+	FONSquad q;
+	float invscale = 1.0f / run->scale;
+	int generation = ctx->fontAtlasGeneration;
+	float* quad;
+
+	run->nquads = 0;
+	run->bounds[0] = run->bounds[1] = 1e6f;
+	run->bounds[2] = run->bounds[3] = -1e6f;
+
+	fonsTextIterInit(ctx->fs, &iter, 0, 0, string, end, FONS_GLYPH_BITMAP_REQUIRED);
+	prevIter = iter;
+	while (fonsTextIterNext(ctx->fs, &iter, &q)) {
+		if (iter.prevGlyphIndex == -1) { // can not retrieve glyph?
+			if (!nvg__allocTextAtlas(ctx))
+				break; // no memory :(
+			iter = prevIter;
+			fonsTextIterNext(ctx->fs, &iter, &q); // try again
+			if (iter.prevGlyphIndex == -1) // still can not find glyph?
+				break;
+		}
+		prevIter = iter;
+		quad = &run->quads[run->nquads*8];
+		quad[0] = q.x0*invscale; quad[1] = q.y0*invscale;
+		quad[2] = q.x1*invscale; quad[3] = q.y1*invscale;
+		quad[4] = q.s0; quad[5] = q.t0;
+		quad[6] = q.s1; quad[7] = q.t1;
+		run->bounds[0] = nvg__minf(run->bounds[0], quad[0]);
+		run->bounds[1] = nvg__minf(run->bounds[1], quad[1]);
+		run->bounds[2] = nvg__maxf(run->bounds[2], quad[2]);
+		run->bounds[3] = nvg__maxf(run->bounds[3], quad[3]);
+		run->nquads++;
+	}
+	run->advance = iter.nextx * invscale;
+
+	if (run->nquads == 0)
+		run->bounds[0] = run->bounds[1] = run->bounds[2] = run->bounds[3] = 0;
+
+	// Glyphs placed before the atlas was reset are gone, the caller has to build the run again.
+	return generation == ctx->fontAtlasGeneration;
+}
+
+NVGtextRun* nvgCreateTextRun(NVGcontext* ctx, const char* string, const char* end)
+{
+	NVGstate* state = nvg__getState(ctx);
+	NVGtextRun* run;
+	int capacity;
+
+	if (end == NULL)
+		end = string + strlen(string);
+
+	if (state->fontId == FONS_INVALID) return NULL;
+
+	run = (NVGtextRun*)malloc(sizeof(NVGtextRun));
+	if (run == NULL) return NULL;
+	memset(run, 0, sizeof(NVGtextRun));
+
+	capacity = nvg__maxi(1, (int)(end - string));
+	run->quads = (float*)malloc(sizeof(float)*8*capacity);
+	if (run->quads == NULL) {
+		free(run);
+		return NULL;
+	}
+
+	run->scale = nvg__getTextScale(ctx, state);
+	run->fontId = state->fontId;
+	run->fontSize = state->fontSize;
+
+	fonsSetSize(ctx->fs, state->fontSize*run->scale);
+	fonsSetSpacing(ctx->fs, state->letterSpacing*run->scale);
+	fonsSetBlur(ctx->fs, state->fontBlur*run->scale);
+	fonsSetAlign(ctx->fs, state->textAlign);
+	fonsSetFont(ctx->fs, state->fontId);
+
+	if (!nvg__buildTextRun(ctx, run, string, end))
+		nvg__buildTextRun(ctx, run, string, end);
+	run->generation = ctx->fontAtlasGeneration;
+
+	fonsVertMetrics(ctx->fs, &run->ascender, &run->descender, &run->lineh);
+	run->ascender /= run->scale;
+	run->descender /= run->scale;
+	run->lineh /= run->scale;
+
+	nvg__flushTextTexture(ctx);
+
+	return run;
+}
+
+int nvgTextRunValid(NVGcontext* ctx, NVGtextRun* run)
+{
+	NVGstate* state = nvg__getState(ctx);
+	if (run == NULL) return 0;
+	return run->generation == ctx->fontAtlasGeneration &&
+		run->scale == nvg__getTextScale(ctx, state);
+}
+
+int nvgDrawTextRun(NVGcontext* ctx, NVGtextRun* run, float x, float y)
+{
+	NVGstate* state = nvg__getState(ctx);
+	NVGvertex* verts;
+	float c[4*2];
+	const float* q;
+	int i, nverts = 0;
+
+	if (!nvgTextRunValid(ctx, run)) return 0;
+	if (run->nquads == 0) return 1;
+
+	verts = nvg__allocTempVerts(ctx, run->nquads*6);
+	if (verts == NULL) return 1;
+
+	for (i = 0; i < run->nquads; i++) {
+		q = &run->quads[i*8];
+		nvgTransformPoint(&c[0],&c[1], state->xform, q[0]+x, q[1]+y);
+		nvgTransformPoint(&c[2],&c[3], state->xform, q[2]+x, q[1]+y);
+		nvgTransformPoint(&c[4],&c[5], state->xform, q[2]+x, q[3]+y);
+		nvgTransformPoint(&c[6],&c[7], state->xform, q[0]+x, q[3]+y);
+		nvg__vset(&verts[nverts], c[0], c[1], q[4], q[5]); nverts++;
+		nvg__vset(&verts[nverts], c[4], c[5], q[6], q[7]); nverts++;
+		nvg__vset(&verts[nverts], c[2], c[3], q[6], q[5]); nverts++;
+		nvg__vset(&verts[nverts], c[0], c[1], q[4], q[5]); nverts++;
+		nvg__vset(&verts[nverts], c[6], c[7], q[4], q[7]); nverts++;
+		nvg__vset(&verts[nverts], c[4], c[5], q[6], q[7]); nverts++;
+	}
+
+	nvg__flushTextTexture(ctx);
+
+	nvg__renderText(ctx, verts, nverts, run->fontId, run->fontSize);
+
+	return 1;
+}
+
+float nvgTextRunBounds(NVGtextRun* run, float* bounds)
+{
+	if (run == NULL) return 0;
+	if (bounds != NULL) {
+		bounds[0] = run->bounds[0];
+		bounds[1] = run->bounds[1];
+		bounds[2] = run->bounds[2];
+		bounds[3] = run->bounds[3];
+	}
+	return run->advance;
+}
+
+void nvgTextRunMetrics(NVGtextRun* run, float* ascender, float* descender, float* lineh)
+{
+	if (run == NULL) return;
+	if (ascender != NULL)
+		*ascender = run->ascender;
+	if (descender != NULL)
+		*descender = run->descender;
+	if (lineh != NULL)
+		*lineh = run->lineh;
+}
+
+void nvgDeleteTextRun(NVGcontext* ctx, NVGtextRun* run)
+{
+	NVG_NOTUSED(ctx);
+	if (run == NULL) return;
+	if (run->quads != NULL) free(run->quads);
+	free(run);
+}
+
 void nvgTextBox(NVGcontext* ctx, float x, float y, float breakRowWidth, const char* string, const char* end)
 {
 	NVGstate* state = nvg__getState(ctx);
@@ -2513,7 +3006,7 @@ void nvgTextBox(NVGcontext* ctx, float x, float y, float breakRowWidth, const ch
 int nvgTextGlyphPositions(NVGcontext* ctx, float x, float y, const char* string, const char* end, NVGglyphPosition* positions, int maxPositions)
 {
 	NVGstate* state = nvg__getState(ctx);
-	float scale = nvg__getFontScale(state) * ctx->devicePxRatio;
+	float scale = nvg__getTextScale(ctx, state);
 	float invscale = 1.0f / scale;
 	FONStextIter iter, prevIter;
 	FONSquad q;
@@ -2563,7 +3056,7 @@ enum NVGcodepointType {
 int nvgTextBreakLines(NVGcontext* ctx, const char* string, const char* end, float breakRowWidth, NVGtextRow* rows, int maxRows)
 {
 	NVGstate* state = nvg__getState(ctx);
-	float scale = nvg__getFontScale(state) * ctx->devicePxRatio;
+	float scale = nvg__getTextScale(ctx, state);
 	float invscale = 1.0f / scale;
 	FONStextIter iter, prevIter;
 	FONSquad q;
@@ -2769,7 +3262,7 @@ int nvgTextBreakLines(NVGcontext* ctx, const char* string, const char* end, floa
 float nvgTextBounds(NVGcontext* ctx, float x, float y, const char* string, const char* end, float* bounds)
 {
 	NVGstate* state = nvg__getState(ctx);
-	float scale = nvg__getFontScale(state) * ctx->devicePxRatio;
+	float scale = nvg__getTextScale(ctx, state);
 	float invscale = 1.0f / scale;
 	float width;
 
@@ -2797,7 +3290,7 @@ void nvgTextBoxBounds(NVGcontext* ctx, float x, float y, float breakRowWidth, co
 {
 	NVGstate* state = nvg__getState(ctx);
 	NVGtextRow rows[2];
-	float scale = nvg__getFontScale(state) * ctx->devicePxRatio;
+	float scale = nvg__getTextScale(ctx, state);
 	float invscale = 1.0f / scale;
 	int nrows = 0, i;
 	int oldAlign = state->textAlign;
@@ -2865,7 +3358,7 @@ void nvgTextBoxBounds(NVGcontext* ctx, float x, float y, float breakRowWidth, co
 void nvgTextMetrics(NVGcontext* ctx, float* ascender, float* descender, float* lineh)
 {
 	NVGstate* state = nvg__getState(ctx);
-	float scale = nvg__getFontScale(state) * ctx->devicePxRatio;
+	float scale = nvg__getTextScale(ctx, state);
 	float invscale = 1.0f / scale;
 
 	if (state->fontId == FONS_INVALID) return;
@@ -502,6 +502,60 @@ void nvgFill(NVGcontext* ctx);
 // Fills the current path with current stroke style.
 void nvgStroke(NVGcontext* ctx);
 
+//
+// Shapes
+//
+// Shapes store the tessellated fill geometry of a path so that it can be drawn again
+// without rebuilding, flattening and expanding the path every frame. The path should be
+// defined with identity transform, the current transform is applied when the shape is drawn.
+// Curves are tessellated and the anti-alias fringe is sized for the scale passed at creation,
+// so shapes drawn at a noticeably different scale should be recreated for it.
+
+typedef struct NVGshape NVGshape;
+
+// Creates a shape from the current path for drawing at scale 1. Returns NULL on failure.
+NVGshape* nvgCreateShape(NVGcontext* ctx);
+
+// Creates a shape from the current path for drawing under a transform of the given scale.
+NVGshape* nvgCreateShapeScaled(NVGcontext* ctx, float scale);
+
+// Fills the shape with current fill style, offset by x,y in local space.
+void nvgFillShape(NVGcontext* ctx, NVGshape* shape, float x, float y);
+
+// Deletes a shape created with nvgCreateShape().
+void nvgDeleteShape(NVGcontext* ctx, NVGshape* shape);
+
+//
+// Triangles
+//
+// Draws a batch of textured triangles, bypassing path tessellation. Batches are split into
+// draw calls of at most 65535 vertices to fit the backend's 16-bit indices.
+// Vertices are interleaved as x,y,u,v, three per triangle, in local space. The image is sampled
+// at u,v and multiplied with the current fill color, so a plain white image gives solid quads.
+// Useful for particles and tile maps, where thousands of quads share one paint.
+// All vertices of a frame share one bgfx transient vertex buffer (6 MB, about 393k vertices,
+// by default). A frame that overflows it is truncated, so keep batches well below that.
+
+// Draws nverts vertices as a triangle list using image and the current fill color.
+void nvgTriangles(NVGcontext* ctx, int image, const float* verts, int nverts);
+
+// Draws count quads in one instanced draw call. Each instance is x,y,t,unused in local space:
+// the quad is centered at x,y and t in 0..1 interpolates its size from startSize to endSize and
+// its color from the current fill color to endColor. Only 16 bytes per quad are uploaded, they
+// come from the same per-frame transient pool as other vertices (about 393k quads by default).
+void nvgQuads(NVGcontext* ctx, int image, const float* instances, int count, float startSize, float endSize, NVGcolor endColor);
+
+// Uploads nverts x,y,u,v vertices (as for nvgTriangles) once into a static GPU buffer, for
+// geometry drawn unchanged across many frames. Returns a handle, or 0 on failure.
+int nvgCreateTriangleBuffer(NVGcontext* ctx, const float* verts, int nverts);
+
+// Draws a triangle buffer using image and the current fill color. The current transform is
+// applied on the GPU, so nothing is uploaded per frame.
+void nvgTriangleBuffer(NVGcontext* ctx, int buffer, int image);
+
+// Deletes a buffer created with nvgCreateTriangleBuffer().
+void nvgDeleteTriangleBuffer(NVGcontext* ctx, int buffer);
+
 
 //
 // Text
@@ -544,15 +598,31 @@ int nvgCreateFont(NVGcontext* ctx, const char* name, const char* filename);
 // Returns handle to the font.
 int nvgCreateFontMem(NVGcontext* ctx, const char* name, unsigned char* data, int ndata, int freeData);
 
+// Releases a font created with nvgCreateFont*. The handle is not reused and draws nothing afterwards.
+void nvgDeleteFont(NVGcontext* ctx, int font);
+
 // Finds a loaded font of specified name, and returns handle to it, or -1 if the font is not found.
 int nvgFindFont(NVGcontext* ctx, const char* name);
 
+// Renders the font from signed distance fields rasterized once at referenceSize pixels, so every
+// text size and zoom level shares the same glyphs. Needs a back-end with renderSdfTriangles.
+// Returns 0 if the font stays a bitmap font.
+int nvgFontSDF(NVGcontext* ctx, int font, float referenceSize);
+
 // Adds a fallback font by handle.
 int nvgAddFallbackFontId(NVGcontext* ctx, int baseFont, int fallbackFont);
 
 // Adds a fallback font by name.
 int nvgAddFallbackFont(NVGcontext* ctx, const char* baseFont, const char* fallbackFont);
 
+// Serializes the font atlas bitmap and glyph tables so they can be restored on the next run.
+// Returns a buffer that must be released with free(), or NULL on failure.
+unsigned char* nvgSaveFontAtlas(NVGcontext* ctx, int* ndata);
+
+// Restores a font atlas saved with nvgSaveFontAtlas(). Glyphs are restored for fonts created with
+// the same name and data, so load the fonts first. Should be called outside of a frame.
+int nvgLoadFontAtlas(NVGcontext* ctx, const unsigned char* data, int ndata);
+
 // Sets the font size of current text style.
 void nvgFontSize(NVGcontext* ctx, float size);
 
@@ -568,6 +638,15 @@ void nvgTextLineHeight(NVGcontext* ctx, float lineHeight);
 // Sets the text align of current text style, see NVGalign for options.
 void nvgTextAlign(NVGcontext* ctx, int align);
 
+// Sets the device pixel ratio used for tessellation and glyph rasterization until the next
+// nvgBeginFrame(), e.g. to prepare glyphs before the first frame. Returns the previous ratio.
+float nvgDevicePixelRatio(NVGcontext* ctx, float ratio);
+
+// Snaps the transform scale used to rasterize glyphs to the given number of steps per octave,
+// so that animated scale and zoom reuse already rasterized glyph sizes. Text keeps its displayed size,
+// only the rasterization resolution is rounded. 0 disables quantization (default).
+void nvgTextScaleQuantization(NVGcontext* ctx, int stepsPerOctave);
+
 // Sets the font face based on specified id of current text style.
 void nvgFontFaceId(NVGcontext* ctx, int font);
 
@@ -606,6 +685,35 @@ void nvgTextMetrics(NVGcontext* ctx, float* ascender, float* descender, float* l
 // Words longer than the max width are slit at nearest character (i.e. no hyphenation).
 int nvgTextBreakLines(NVGcontext* ctx, const char* string, const char* end, float breakRowWidth, NVGtextRow* rows, int maxRows);
 
+//
+// Text runs
+//
+// Text runs store the positioned glyph quads of a string laid out with the current font,
+// size, spacing, blur and alignment, so static labels can be drawn again without running
+// the glyph iteration every frame. A run is only valid while the glyphs it refers to are in
+// the font atlas and for the text scale it was created at. nvgDrawTextRun() returns 0 and
+// draws nothing when the run is stale, in which case it should be created again.
+
+typedef struct NVGtextRun NVGtextRun;
+
+// Creates a text run at origin 0,0 using the current text state. Returns NULL on failure.
+NVGtextRun* nvgCreateTextRun(NVGcontext* ctx, const char* string, const char* end);
+
+// Returns 1 if the run can still be drawn with the current atlas and transform scale.
+int nvgTextRunValid(NVGcontext* ctx, NVGtextRun* run);
+
+// Draws the run with the current fill color, offset by x,y in local space.
+int nvgDrawTextRun(NVGcontext* ctx, NVGtextRun* run, float x, float y);
+
+// Returns the horizontal advance of the run, bounds receives [xmin,ymin, xmax,ymax] of its glyphs.
+float nvgTextRunBounds(NVGtextRun* run, float* bounds);
+
+// Returns the vertical metrics of the font the run was created with.
+void nvgTextRunMetrics(NVGtextRun* run, float* ascender, float* descender, float* lineh);
+
+// Deletes a text run created with nvgCreateTextRun().
+void nvgDeleteTextRun(NVGcontext* ctx, NVGtextRun* run);
+
 //
 // Internal Render API
 //
@@ -653,6 +761,11 @@ struct NVGparams {
 	void (*renderFill)(void* uptr, NVGpaint* paint, NVGcompositeOperationState compositeOperation, NVGscissor* scissor, float fringe, const float* bounds, const NVGpath* paths, int npaths);
 	void (*renderStroke)(void* uptr, NVGpaint* paint, NVGcompositeOperationState compositeOperation, NVGscissor* scissor, float fringe, float strokeWidth, const NVGpath* paths, int npaths);
 	void (*renderTriangles)(void* uptr, NVGpaint* paint, NVGcompositeOperationState compositeOperation, NVGscissor* scissor, const NVGvertex* verts, int nverts);
+	void (*renderSdfTriangles)(void* uptr, NVGpaint* paint, NVGcompositeOperationState compositeOperation, NVGscissor* scissor, const NVGvertex* verts, int nverts, float smoothing);
+	void (*renderQuads)(void* uptr, NVGpaint* paint, NVGcompositeOperationState compositeOperation, NVGscissor* scissor, const float* xform, const float* instances, int count, float startSize, float endSize);
+	int (*renderCreateBuffer)(void* uptr, const NVGvertex* verts, int nverts);
+	void (*renderDeleteBuffer)(void* uptr, int buffer);
+	void (*renderBufferTriangles)(void* uptr, NVGpaint* paint, NVGcompositeOperationState compositeOperation, NVGscissor* scissor, const float* xform, int buffer);
 	void (*renderDelete)(void* uptr);
 };
 typedef struct NVGparams NVGparams;
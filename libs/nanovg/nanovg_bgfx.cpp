@@ -33,15 +33,25 @@
 #include <bx/allocator.h>
 #include <bx/uint32_t.h>
 
+#include <stb_image_resize2.h>
+
 BX_PRAGMA_DIAGNOSTIC_IGNORED_MSVC(4244); // warning C4244: '=' : conversion from '' to '', possible loss of data
 
 #include "vs_nanovg_fill.bin.h"
 #include "fs_nanovg_fill.bin.h"
+#include "fs_nanovg_sdf.bin.h"
+#include "vs_nanovg_quad.bin.h"
+#include "vs_nanovg_xform.bin.h"
+#include "fs_nanovg_quad.bin.h"
 
 static const bgfx::EmbeddedShader s_embeddedShaders[] =
 {
 	BGFX_EMBEDDED_SHADER(vs_nanovg_fill),
 	BGFX_EMBEDDED_SHADER(fs_nanovg_fill),
+	BGFX_EMBEDDED_SHADER(fs_nanovg_sdf),
+	BGFX_EMBEDDED_SHADER(vs_nanovg_quad),
+	BGFX_EMBEDDED_SHADER(vs_nanovg_xform),
+	BGFX_EMBEDDED_SHADER(fs_nanovg_quad),
 
 	BGFX_EMBEDDED_SHADER_END()
 };
@@ -64,6 +74,7 @@ namespace
 		int width, height;
 		int type;
 		int flags;
+		bool mips;
 	};
 
 	struct GLNVGblend
@@ -80,6 +91,9 @@ namespace
 		GLNVG_CONVEXFILL,
 		GLNVG_STROKE,
 		GLNVG_TRIANGLES,
+		GLNVG_SDF_TRIANGLES,
+		GLNVG_QUADS,
+		GLNVG_BUFFER_TRIANGLES,
 	};
 
 	struct GLNVGcall
@@ -92,6 +106,12 @@ namespace
 		int vertexCount;
 		int uniformOffset;
 		GLNVGblend blendFunc;
+
+		// GLNVG_QUADS and GLNVG_BUFFER_TRIANGLES are transformed on the GPU.
+		float xform[8];
+		float quadSize[4];
+		bgfx::InstanceDataBuffer instances;
+		bgfx::VertexBufferHandle buffer;
 	};
 
 	struct GLNVGpath
@@ -129,6 +149,9 @@ namespace
 		bx::AllocatorI* allocator;
 
 		bgfx::ProgramHandle prog;
+		bgfx::ProgramHandle progSdf;
+		bgfx::ProgramHandle progQuad;
+		bgfx::ProgramHandle progBuffer;
 		bgfx::UniformHandle u_scissorMat;
 		bgfx::UniformHandle u_paintMat;
 		bgfx::UniformHandle u_innerCol;
@@ -137,9 +160,15 @@ namespace
 		bgfx::UniformHandle u_scissorExtScale;
 		bgfx::UniformHandle u_extentRadius;
 		bgfx::UniformHandle u_params;
+		bgfx::UniformHandle u_xform;
+		bgfx::UniformHandle u_quadSize;
 
 		bgfx::UniformHandle s_tex;
 
+		bgfx::VertexBufferHandle quadVertices;
+		bgfx::IndexBufferHandle quadIndices;
+		bool instancing;
+
 		uint64_t state;
 		bgfx::TextureHandle th;
 		bgfx::TextureHandle texMissing;
@@ -251,6 +280,21 @@ namespace
 						, bgfx::createEmbeddedShader(s_embeddedShaders, type, "fs_nanovg_fill")
 						, true
 						);
+		gl->progSdf = bgfx::createProgram(
+						  bgfx::createEmbeddedShader(s_embeddedShaders, type, "vs_nanovg_fill")
+						, bgfx::createEmbeddedShader(s_embeddedShaders, type, "fs_nanovg_sdf")
+						, true
+						);
+		gl->progQuad = bgfx::createProgram(
+						  bgfx::createEmbeddedShader(s_embeddedShaders, type, "vs_nanovg_quad")
+						, bgfx::createEmbeddedShader(s_embeddedShaders, type, "fs_nanovg_quad")
+						, true
+						);
+		gl->progBuffer = bgfx::createProgram(
+						  bgfx::createEmbeddedShader(s_embeddedShaders, type, "vs_nanovg_xform")
+						, bgfx::createEmbeddedShader(s_embeddedShaders, type, "fs_nanovg_quad")
+						, true
+						);
 
 		const bgfx::Memory* mem = bgfx::alloc(4*4*4);
 		uint32_t* bgra8 = (uint32_t*)mem->data;
@@ -265,6 +309,8 @@ namespace
 		gl->u_scissorExtScale = bgfx::createUniform("u_scissorExtScale", bgfx::UniformType::Vec4);
 		gl->u_extentRadius    = bgfx::createUniform("u_extentRadius",    bgfx::UniformType::Vec4);
 		gl->u_params          = bgfx::createUniform("u_params",          bgfx::UniformType::Vec4);
+		gl->u_xform           = bgfx::createUniform("u_xform",           bgfx::UniformType::Vec4, 2);
+		gl->u_quadSize        = bgfx::createUniform("u_quadSize",        bgfx::UniformType::Vec4);
 		gl->s_tex             = bgfx::createUniform("s_tex",             bgfx::UniformType::Sampler);
 
 		s_nvgLayout
@@ -273,12 +319,60 @@ namespace
 			.add(bgfx::Attrib::TexCoord0, 2, bgfx::AttribType::Float)
 			.end();
 
+		// Unit quad around the origin, scaled and placed per instance by vs_nanovg_quad.
+		static const NVGvertex s_quadVertices[4] =
+		{
+			{ -0.5f, -0.5f, 0.0f, 0.0f },
+			{  0.5f, -0.5f, 1.0f, 0.0f },
+			{  0.5f,  0.5f, 1.0f, 1.0f },
+			{ -0.5f,  0.5f, 0.0f, 1.0f },
+		};
+		static const uint16_t s_quadIndices[6] = { 0, 1, 2, 0, 2, 3 };
+
+		gl->quadVertices = bgfx::createVertexBuffer(bgfx::makeRef(s_quadVertices, sizeof(s_quadVertices) ), s_nvgLayout);
+		gl->quadIndices  = bgfx::createIndexBuffer(bgfx::makeRef(s_quadIndices, sizeof(s_quadIndices) ) );
+		gl->instancing   = 0 != (bgfx::getCaps()->supported & BGFX_CAPS_INSTANCING);
+
 		int align = 16;
 		gl->fragSize = sizeof(struct GLNVGfragUniforms) + align - sizeof(struct GLNVGfragUniforms) % align;
 
 		return 1;
 	}
 
+	static uint64_t glnvg__samplerFlags(int _flags)
+	{
+		uint64_t flags = BGFX_SAMPLER_NONE;
+
+		if (_flags & NVG_IMAGE_NEAREST)
+		{
+			flags |= BGFX_SAMPLER_MIN_POINT | BGFX_SAMPLER_MAG_POINT | BGFX_SAMPLER_MIP_POINT;
+		}
+
+		return flags;
+	}
+
+	static void glnvg__generateMips(struct GLNVGtexture* tex, const unsigned char* _rgba)
+	{
+		// Each level is filtered from the previous one, in sRGB space with unpremultiplied alpha.
+		const unsigned char* src = _rgba;
+		int w = tex->width;
+		int h = tex->height;
+
+		for (uint8_t mip = 1; w > 1 || h > 1; ++mip)
+		{
+			const int mw = bx::max(w / 2, 1);
+			const int mh = bx::max(h / 2, 1);
+			const bgfx::Memory* mem = bgfx::alloc(uint32_t(mw * mh * 4) );
+
+			stbir_resize_uint8_srgb(src, w, h, 0, mem->data, mw, mh, 0, STBIR_RGBA);
+			bgfx::updateTexture2D(tex->id, 0, mip, 0, 0, uint16_t(mw), uint16_t(mh), mem);
+
+			src = mem->data;
+			w = mw;
+			h = mh;
+		}
+	}
+
 	static int nvgRenderCreateTexture(
 		  void* _userPtr
 		, int _type
@@ -313,13 +407,19 @@ namespace
 		BX_ASSERT(tex->width >= 0 && tex->width <= bx::max<uint16_t>(), "Invalid tex width %d (max: %u)",  tex->width, bx::max<uint16_t>());
 		BX_ASSERT(tex->height >= 0 && tex->height <= bx::max<uint16_t>(), "Invalid tex height %d (max: %u)",  tex->height, bx::max<uint16_t>());
 
+		const bool hasMips = NVG_TEXTURE_RGBA == _type
+			&& NULL != _rgba
+			&& 0 != (_flags & NVG_IMAGE_GENERATE_MIPMAPS)
+			;
+
+		tex->mips = hasMips;
 		tex->id = bgfx::createTexture2D(
 						  uint16_t(tex->width)
 						, uint16_t(tex->height)
-						, false
+						, hasMips
 						, 1
 						, NVG_TEXTURE_RGBA == _type ? bgfx::TextureFormat::RGBA8 : bgfx::TextureFormat::R8
-						, BGFX_SAMPLER_NONE
+						, glnvg__samplerFlags(_flags)
 						);
 
 		if (NULL != mem)
@@ -336,6 +436,11 @@ namespace
 				);
 		}
 
+		if (hasMips && bgfx::isValid(tex->id) )
+		{
+			glnvg__generateMips(tex, _rgba);
+		}
+
 		return bgfx::isValid(tex->id) ? tex->id.idx : 0;
 	}
 
@@ -381,6 +486,12 @@ namespace
 			, UINT16_MAX
 			);
 
+		// The lower levels would keep showing the old image, filter them again from the full image.
+		if (tex->mips)
+		{
+			glnvg__generateMips(tex, data);
+		}
+
 		return 1;
 	}
 
@@ -417,6 +528,14 @@ namespace
 		m3[11] = 0.0f;
 	}
 
+	// Two vec4s as read by u_xform: a,b,c,d and e,f.
+	static void glnvg__xformToVec4x2(float* dst, const float* t)
+	{
+		bx::memCopy(dst, t, sizeof(float) * 6);
+		dst[6] = 0.0f;
+		dst[7] = 0.0f;
+	}
+
 	static NVGcolor glnvg__premulColor(NVGcolor c)
 	{
 		c.r *= c.a;
@@ -695,7 +814,7 @@ namespace
 		}
 	}
 
-	static void glnvg__triangles(struct GLNVGcontext* gl, struct GLNVGcall* call)
+	static void glnvg__triangles(struct GLNVGcontext* gl, struct GLNVGcall* call, bgfx::ProgramHandle prog)
 	{
 		if (3 <= call->vertexCount)
 		{
@@ -704,10 +823,35 @@ namespace
 			bgfx::setState(gl->state);
 			bgfx::setVertexBuffer(0, &gl->tvb, call->vertexOffset, call->vertexCount);
 			bgfx::setTexture(0, gl->s_tex, gl->th);
-			bgfx::submit(gl->viewId, gl->prog);
+			bgfx::submit(gl->viewId, prog);
 		}
 	}
 
+	static void glnvg__quads(struct GLNVGcontext* gl, struct GLNVGcall* call)
+	{
+		nvgRenderSetUniforms(gl, call->uniformOffset, call->image);
+		bgfx::setUniform(gl->u_xform, call->xform, 2);
+		bgfx::setUniform(gl->u_quadSize, call->quadSize);
+
+		bgfx::setState(gl->state);
+		bgfx::setVertexBuffer(0, gl->quadVertices);
+		bgfx::setIndexBuffer(gl->quadIndices);
+		bgfx::setInstanceDataBuffer(&call->instances);
+		bgfx::setTexture(0, gl->s_tex, gl->th);
+		bgfx::submit(gl->viewId, gl->progQuad);
+	}
+
+	static void glnvg__bufferTriangles(struct GLNVGcontext* gl, struct GLNVGcall* call)
+	{
+		nvgRenderSetUniforms(gl, call->uniformOffset, call->image);
+		bgfx::setUniform(gl->u_xform, call->xform, 2);
+
+		bgfx::setState(gl->state);
+		bgfx::setVertexBuffer(0, call->buffer);
+		bgfx::setTexture(0, gl->s_tex, gl->th);
+		bgfx::submit(gl->viewId, gl->progBuffer);
+	}
+
 	static const uint64_t s_blend[] =
 	{
 		BGFX_STATE_BLEND_ZERO,
@@ -764,18 +908,22 @@ namespace
 				}
 			}
 
-			bgfx::allocTransientVertexBuffer(&gl->tvb, gl->nverts, s_nvgLayout);
+			// Quads and buffer triangles bring their own vertices, a frame of only those has none here.
+			if (gl->nverts > 0)
+			{
+				bgfx::allocTransientVertexBuffer(&gl->tvb, gl->nverts, s_nvgLayout);
 
-			int allocated = gl->tvb.size/gl->tvb.stride;
+				int allocated = gl->tvb.size/gl->tvb.stride;
 
-			if (allocated < gl->nverts)
-			{
-				// this branch should never be taken as we've already checked the transient vertex buffer size
-				gl->nverts = allocated;
-				BX_WARN(true, "Vertex number truncated due to transient vertex buffer overflow");
-			}
+				if (allocated < gl->nverts)
+				{
+					// this branch should never be taken as we've already checked the transient vertex buffer size
+					gl->nverts = allocated;
+					BX_WARN(true, "Vertex number truncated due to transient vertex buffer overflow");
+				}
 
-			bx::memCopy(gl->tvb.data, gl->verts, gl->nverts * sizeof(struct NVGvertex) );
+				bx::memCopy(gl->tvb.data, gl->verts, gl->nverts * sizeof(struct NVGvertex) );
+			}
 
 			bgfx::setUniform(gl->u_viewSize, gl->view);
 
@@ -802,7 +950,19 @@ namespace
 					break;
 
 				case GLNVG_TRIANGLES:
-					glnvg__triangles(gl, call);
+					glnvg__triangles(gl, call, gl->prog);
+					break;
+
+				case GLNVG_SDF_TRIANGLES:
+					glnvg__triangles(gl, call, gl->progSdf);
+					break;
+
+				case GLNVG_QUADS:
+					glnvg__quads(gl, call);
+					break;
+
+				case GLNVG_BUFFER_TRIANGLES:
+					glnvg__bufferTriangles(gl, call);
 					break;
 				}
 			}
@@ -901,6 +1061,12 @@ _cleanup:
 		vtx->v = v;
 	}
 
+	// A single call is drawn from one 16-bit indexed range and cannot be split here.
+	static bool glnvg__fitsVertexRange(int nverts) {
+		BX_WARN(nverts <= UINT16_MAX, "Triangle call with %d vertices dropped, split it below %d", nverts, UINT16_MAX);
+		return nverts <= UINT16_MAX;
+	}
+
 	static void glnvg__flushIfNeeded(struct GLNVGcontext *gl, int nverts) {
 		if (gl->nverts + nverts > UINT16_MAX) {
 			nvgRenderFlush(gl);
@@ -1045,6 +1211,7 @@ _cleanup:
 									   const struct NVGvertex* verts, int nverts)
 	{
 		struct GLNVGcontext* gl = (struct GLNVGcontext*)_userPtr;
+		if (!glnvg__fitsVertexRange(nverts)) return;
 		glnvg__flushIfNeeded(gl, nverts);
 
 		struct GLNVGcall* call = glnvg__allocCall(gl);
@@ -1066,6 +1233,98 @@ _cleanup:
 		frag->type = NSVG_SHADER_IMG;
 	}
 
+	static void nvgRenderSdfTriangles(void* _userPtr, struct NVGpaint* paint, NVGcompositeOperationState compositeOperation, struct NVGscissor* scissor,
+									   const struct NVGvertex* verts, int nverts, float smoothing)
+	{
+		struct GLNVGcontext* gl = (struct GLNVGcontext*)_userPtr;
+		if (!glnvg__fitsVertexRange(nverts)) return;
+		glnvg__flushIfNeeded(gl, nverts);
+
+		struct GLNVGcall* call = glnvg__allocCall(gl);
+		struct GLNVGfragUniforms* frag;
+
+		call->type = GLNVG_SDF_TRIANGLES;
+		call->image = paint->image;
+		call->blendFunc = glnvg__blendCompositeOperation(compositeOperation);
+
+		call->vertexOffset = glnvg__allocVerts(gl, nverts);
+		call->vertexCount = nverts;
+		bx::memCopy(&gl->verts[call->vertexOffset], verts, sizeof(struct NVGvertex) * nverts);
+
+		// fs_nanovg_sdf reads the smoothing width from u_params.x.
+		call->uniformOffset = glnvg__allocFragUniforms(gl, 1);
+		frag = nvg__fragUniformPtr(gl, call->uniformOffset);
+		glnvg__convertPaint(gl, frag, paint, scissor, 1.0f, 1.0f);
+		frag->type = NSVG_SHADER_IMG;
+		frag->feather = smoothing;
+	}
+
+	static void nvgRenderQuads(void* _userPtr, struct NVGpaint* paint, NVGcompositeOperationState compositeOperation, struct NVGscissor* scissor,
+							   const float* xform, const float* instances, int count, float startSize, float endSize)
+	{
+		struct GLNVGcontext* gl = (struct GLNVGcontext*)_userPtr;
+		BX_WARN(gl->instancing, "nvgQuads needs instancing, which this renderer does not support");
+		if (!gl->instancing) return;
+
+		// Instances share the frame's transient pool with the path vertices.
+		const uint16_t stride = 4 * sizeof(float);
+		uint32_t num = bgfx::getAvailInstanceDataBuffer(count, stride);
+		BX_WARN(num == uint32_t(count), "Quad instances truncated due to transient vertex buffer overflow");
+		if (num == 0) return;
+
+		struct GLNVGcall* call = glnvg__allocCall(gl);
+		struct GLNVGfragUniforms* frag;
+
+		call->type = GLNVG_QUADS;
+		call->image = paint->image;
+		call->blendFunc = glnvg__blendCompositeOperation(compositeOperation);
+		glnvg__xformToVec4x2(call->xform, xform);
+		call->quadSize[0] = startSize;
+		call->quadSize[1] = endSize;
+
+		bgfx::allocInstanceDataBuffer(&call->instances, num, stride);
+		bx::memCopy(call->instances.data, instances, num * stride);
+
+		// vs_nanovg_quad interpolates between u_innerCol and u_outerCol.
+		call->uniformOffset = glnvg__allocFragUniforms(gl, 1);
+		frag = nvg__fragUniformPtr(gl, call->uniformOffset);
+		glnvg__convertPaint(gl, frag, paint, scissor, 1.0f, 1.0f);
+		frag->type = NSVG_SHADER_IMG;
+	}
+
+	static int nvgRenderCreateBuffer(void* /*_userPtr*/, const struct NVGvertex* verts, int nverts)
+	{
+		bgfx::VertexBufferHandle handle = bgfx::createVertexBuffer(bgfx::copy(verts, sizeof(struct NVGvertex) * nverts), s_nvgLayout);
+		return bgfx::isValid(handle) ? handle.idx + 1 : 0;
+	}
+
+	static void nvgRenderDeleteBuffer(void* /*_userPtr*/, int buffer)
+	{
+		bgfx::VertexBufferHandle handle = { uint16_t(buffer - 1) };
+		bgfx::destroy(handle);
+	}
+
+	static void nvgRenderBufferTriangles(void* _userPtr, struct NVGpaint* paint, NVGcompositeOperationState compositeOperation, struct NVGscissor* scissor,
+										 const float* xform, int buffer)
+	{
+		struct GLNVGcontext* gl = (struct GLNVGcontext*)_userPtr;
+
+		struct GLNVGcall* call = glnvg__allocCall(gl);
+		struct GLNVGfragUniforms* frag;
+
+		call->type = GLNVG_BUFFER_TRIANGLES;
+		call->image = paint->image;
+		call->blendFunc = glnvg__blendCompositeOperation(compositeOperation);
+		call->buffer.idx = uint16_t(buffer - 1);
+		glnvg__xformToVec4x2(call->xform, xform);
+
+		// Without an instance t, vs_nanovg_xform takes the color from u_innerCol.
+		call->uniformOffset = glnvg__allocFragUniforms(gl, 1);
+		frag = nvg__fragUniformPtr(gl, call->uniformOffset);
+		glnvg__convertPaint(gl, frag, paint, scissor, 1.0f, 1.0f);
+		frag->type = NSVG_SHADER_IMG;
+	}
+
 	static void nvgRenderDelete(void* _userPtr)
 	{
 		struct GLNVGcontext* gl = (struct GLNVGcontext*)_userPtr;
@@ -1076,7 +1335,12 @@ _cleanup:
 		}
 
 		bgfx::destroy(gl->prog);
+		bgfx::destroy(gl->progSdf);
+		bgfx::destroy(gl->progQuad);
+		bgfx::destroy(gl->progBuffer);
 		bgfx::destroy(gl->texMissing);
+		bgfx::destroy(gl->quadVertices);
+		bgfx::destroy(gl->quadIndices);
 
 		bgfx::destroy(gl->u_scissorMat);
 		bgfx::destroy(gl->u_paintMat);
@@ -1086,6 +1350,8 @@ _cleanup:
 		bgfx::destroy(gl->u_scissorExtScale);
 		bgfx::destroy(gl->u_extentRadius);
 		bgfx::destroy(gl->u_params);
+		bgfx::destroy(gl->u_xform);
+		bgfx::destroy(gl->u_quadSize);
 		bgfx::destroy(gl->s_tex);
 
 		for (uint32_t ii = 0, num = gl->ntextures; ii < num; ++ii)
@@ -1136,6 +1402,11 @@ NVGcontext* nvgCreate(int32_t _edgeaa, bgfx::ViewId _viewId, bx::AllocatorI* _al
 	params.renderFill           = nvgRenderFill;
 	params.renderStroke         = nvgRenderStroke;
 	params.renderTriangles      = nvgRenderTriangles;
+	params.renderSdfTriangles   = nvgRenderSdfTriangles;
+	params.renderQuads          = nvgRenderQuads;
+	params.renderCreateBuffer   = nvgRenderCreateBuffer;
+	params.renderDeleteBuffer   = nvgRenderDeleteBuffer;
+	params.renderBufferTriangles = nvgRenderBufferTriangles;
 	params.renderDelete         = nvgRenderDelete;
 	params.userPtr              = gl;
 	params.edgeAntiAlias        = _edgeaa;
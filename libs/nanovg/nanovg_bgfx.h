@@ -84,4 +84,7 @@ void nvgluSetViewFramebuffer(bgfx::ViewId _viewId, NVGLUframebuffer* _framebuffe
 ///
 int nvgCreateBgfxTexture(struct NVGcontext *_ctx, bgfx::TextureHandle _id, int _width, int _height, int _flags);
 
+///
+bgfx::TextureHandle nvglImageHandle(NVGcontext* _ctx, int32_t _image);
+
 #endif // NANOVG_BGFX_H_HEADER_GUARD
@@ -1,5 +1,7 @@
 vec2 v_position  : TEXCOORD0  = vec2(0.0, 0.0);
 vec2 v_texcoord0 : TEXCOORD1 = vec2(0.0, 0.0);
+vec4 v_color0    : COLOR0    = vec4(1.0, 1.0, 1.0, 1.0);
 
 vec2 a_position  : POSITION;
 vec2 a_texcoord0 : TEXCOORD0;
+vec4 i_data0     : TEXCOORD7;
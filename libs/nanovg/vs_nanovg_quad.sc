@@ -0,0 +1,25 @@
+$input a_position, a_texcoord0, i_data0
+$output v_position, v_texcoord0, v_color0
+
+#include <bgfx_shader.sh>
+
+uniform vec4 u_viewSize;
+uniform vec4 u_xform[2];
+uniform vec4 u_quadSize;
+uniform vec4 u_innerCol;
+uniform vec4 u_outerCol;
+
+void main()
+{
+	// i_data0 is the quad center in local space and t, which drives size and color.
+	float t = clamp(i_data0.z, 0.0, 1.0);
+	vec2 point = i_data0.xy + a_position * mix(u_quadSize.x, u_quadSize.y, t);
+
+	v_position  = vec2(
+		  u_xform[0].x * point.x + u_xform[0].z * point.y + u_xform[1].x
+		, u_xform[0].y * point.x + u_xform[0].w * point.y + u_xform[1].y
+		);
+	v_texcoord0 = a_texcoord0;
+	v_color0    = mix(u_innerCol, u_outerCol, t);
+	gl_Position = vec4(2.0*v_position.x/u_viewSize.x - 1.0, 1.0 - 2.0*v_position.y/u_viewSize.y, 0.0, 1.0);
+}
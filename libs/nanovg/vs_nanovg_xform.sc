@@ -0,0 +1,20 @@
+$input a_position, a_texcoord0
+$output v_position, v_texcoord0, v_color0
+
+#include <bgfx_shader.sh>
+
+uniform vec4 u_viewSize;
+uniform vec4 u_xform[2];
+uniform vec4 u_innerCol;
+
+void main()
+{
+	// Static vertices stay in local space, the nanovg transform is applied here instead of on the CPU.
+	v_position  = vec2(
+		  u_xform[0].x * a_position.x + u_xform[0].z * a_position.y + u_xform[1].x
+		, u_xform[0].y * a_position.x + u_xform[0].w * a_position.y + u_xform[1].y
+		);
+	v_texcoord0 = a_texcoord0;
+	v_color0    = u_innerCol;
+	gl_Position = vec4(2.0*v_position.x/u_viewSize.x - 1.0, 1.0 - 2.0*v_position.y/u_viewSize.y, 0.0, 1.0);
+}
@@ -65,4 +65,6 @@ class Animation {
         void reset(float newStart, float newEnd, Easing newEasing);
         
         virtual float animate(float x);
+
+        static float ease(Easing easing, float x);
 };
\ No newline at end of file
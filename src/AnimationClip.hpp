@@ -0,0 +1,31 @@
+﻿#pragma once
+
+#include <string>
+#include <vector>
+
+class AnimationClip {
+    public:
+        using Id = unsigned int;
+        static const Id InvalidId = 0;
+
+        struct Frame {
+            float duration;
+            int frameIndex;
+
+            bool operator==(const Frame&) const = default;
+        };
+
+        AnimationClip(Id id, const std::string& name, const std::vector<Frame>& frames, bool loop)
+            : id(id), name(name), frames(frames), loop(loop) {}
+
+        Id getId() const { return id; }
+        const std::string& getName() const { return name; }
+        const std::vector<Frame>& getFrames() const { return frames; }
+        bool isLooping() const { return loop; }
+
+    private:
+        Id id;
+        std::string name;
+        std::vector<Frame> frames;
+        bool loop;
+};
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include "AnimationClipManager.hpp"
+#include "Logger.hpp"
+
+std::vector<std::shared_ptr<const AnimationClip>>& AnimationClipManager::clips() {
+    static std::vector<std::shared_ptr<const AnimationClip>> m_clips;
+    return m_clips;
+}
+
+std::unordered_map<std::string, AnimationClip::Id>& AnimationClipManager::ids() {
+    static std::unordered_map<std::string, AnimationClip::Id> m_ids;
+    return m_ids;
+}
+
+AnimationClip::Id AnimationClipManager::create(const std::string& name, const std::vector<AnimationClip::Frame>& frames, bool loop) {
+    auto& m_ids = ids();
+    auto it = m_ids.find(name);
+    if (it != m_ids.end()) {
+        auto existing = get(it->second);
+        if (existing->getFrames() == frames && existing->isLooping() == loop) return it->second;
+
+        Logger::warn("AnimationClipManager", "Clip \"" + name + "\" already exists with different frames, unload it first or use another name");
+        return AnimationClip::InvalidId;
+    }
+
+    auto& m_clips = clips();
+    AnimationClip::Id id = static_cast<AnimationClip::Id>(m_clips.size() + 1);
+    m_clips.push_back(std::make_shared<const AnimationClip>(id, name, frames, loop));
+    m_ids[name] = id;
+    return id;
+}
+
+std::shared_ptr<const AnimationClip> AnimationClipManager::get(AnimationClip::Id id) {
+    auto& m_clips = clips();
+    if (id == AnimationClip::InvalidId || id > m_clips.size()) return nullptr;
+    return m_clips[id - 1];
+}
+
+std::shared_ptr<const AnimationClip> AnimationClipManager::get(const std::string& name) {
+    return get(getId(name));
+}
+
+AnimationClip::Id AnimationClipManager::getId(const std::string& name) {
+    auto& m_ids = ids();
+    auto it = m_ids.find(name);
+    if (it != m_ids.end()) return it->second;
+    return AnimationClip::InvalidId;
+}
+
+void AnimationClipManager::unload(const std::string& name) {
+    auto& m_ids = ids();
+    auto it = m_ids.find(name);
+    if (it != m_ids.end()) {
+        clips()[it->second - 1] = nullptr;
+        m_ids.erase(it);
+    }
+}
+
+void AnimationClipManager::unloadAll() {
+    clips().clear();
+    ids().clear();
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+﻿#pragma once
+
+#include "AnimationClip.hpp"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class AnimationClipManager {
+    public:
+        // names are global, creating an existing name with different frames or loop flag fails with InvalidId
+        static AnimationClip::Id create(const std::string& name, const std::vector<AnimationClip::Frame>& frames, bool loop = true);
+        static std::shared_ptr<const AnimationClip> get(AnimationClip::Id id);
+        static std::shared_ptr<const AnimationClip> get(const std::string& name);
+        static AnimationClip::Id getId(const std::string& name);
+
+        static void unload(const std::string& name);
+        static void unloadAll();
+
+    private:
+        static std::vector<std::shared_ptr<const AnimationClip>>& clips();
+        static std::unordered_map<std::string, AnimationClip::Id>& ids();
+};
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include "AnimationSystem.hpp"
+#include "SpriteAnimation.hpp"
+
+void AnimationSystem::updateAll(float deltaTime) {
+    float deltaSeconds = deltaTime / 1000.0f;
+
+    for (auto& state : states) {
+        if (!state.clip || state.finished) continue;
+        advance(state, deltaSeconds);
+    }
+}
+
+void AnimationSystem::advance(State& state, float deltaSeconds) {
+    const auto& frames = state.clip->getFrames();
+    if (frames.empty()) return;
+
+    state.timer += deltaSeconds;
+    while (state.timer >= frames[state.frame].duration) {
+        state.timer -= frames[state.frame].duration;
+        state.frame++;
+        if (state.frame >= frames.size()) {
+            if (state.clip->isLooping()) {
+                state.frame = 0;
+            } else {
+                state.frame = static_cast<unsigned int>(frames.size() - 1);
+                state.finished = true;
+                break;
+            }
+        }
+    }
+}
+
+size_t AnimationSystem::getInstanceCount() {
+    return states.size();
+}
+
+size_t AnimationSystem::add(SpriteAnimation* owner) {
+    states.emplace_back();
+    owners.push_back(owner);
+    return states.size() - 1;
+}
+
+void AnimationSystem::remove(size_t slot) {
+    size_t last = states.size() - 1;
+
+    if (slot != last) {
+        states[slot] = std::move(states[last]);
+        owners[slot] = owners[last];
+        owners[slot]->slot = slot;
+    }
+
+    states.pop_back();
+    owners.pop_back();
+}
\ No newline at end of file
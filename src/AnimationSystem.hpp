@@ -0,0 +1,30 @@
+﻿#pragma once
+
+#include "AnimationClip.hpp"
+#include <memory>
+#include <vector>
+
+class SpriteAnimation;
+
+class AnimationSystem {
+    public:
+        static void updateAll(float deltaTime);
+        static size_t getInstanceCount();
+
+    private:
+        struct State {
+            std::shared_ptr<const AnimationClip> clip;
+            float timer = 0.0f;
+            unsigned int frame = 0;
+            bool finished = false;
+        };
+
+        static inline std::vector<State> states;
+        static inline std::vector<SpriteAnimation*> owners;
+
+        static size_t add(SpriteAnimation* owner);
+        static void remove(size_t slot);
+        static void advance(State& state, float deltaSeconds);
+
+        friend class SpriteAnimation;
+};
\ No newline at end of file
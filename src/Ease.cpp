@@ -0,0 +1,106 @@
+#include "Ease.hpp"
+#include <algorithm>
+
+template<typename Function>
+static decltype(auto) dispatch(Easing easing, Function&& function) {
+    switch (easing) {
+        case Easing::None: return function.template operator()<Easing::None>();
+        case Easing::EaseLinear: return function.template operator()<Easing::EaseLinear>();
+        case Easing::EaseInSine: return function.template operator()<Easing::EaseInSine>();
+        case Easing::EaseOutSine: return function.template operator()<Easing::EaseOutSine>();
+        case Easing::EaseInOutSine: return function.template operator()<Easing::EaseInOutSine>();
+        case Easing::EaseInQuad: return function.template operator()<Easing::EaseInQuad>();
+        case Easing::EaseOutQuad: return function.template operator()<Easing::EaseOutQuad>();
+        case Easing::EaseInOutQuad: return function.template operator()<Easing::EaseInOutQuad>();
+        case Easing::EaseInCubic: return function.template operator()<Easing::EaseInCubic>();
+        case Easing::EaseOutCubic: return function.template operator()<Easing::EaseOutCubic>();
+        case Easing::EaseInOutCubic: return function.template operator()<Easing::EaseInOutCubic>();
+        case Easing::EaseInQuart: return function.template operator()<Easing::EaseInQuart>();
+        case Easing::EaseOutQuart: return function.template operator()<Easing::EaseOutQuart>();
+        case Easing::EaseInOutQuart: return function.template operator()<Easing::EaseInOutQuart>();
+        case Easing::EaseInQuint: return function.template operator()<Easing::EaseInQuint>();
+        case Easing::EaseOutQuint: return function.template operator()<Easing::EaseOutQuint>();
+        case Easing::EaseInOutQuint: return function.template operator()<Easing::EaseInOutQuint>();
+        case Easing::EaseInExpo: return function.template operator()<Easing::EaseInExpo>();
+        case Easing::EaseOutExpo: return function.template operator()<Easing::EaseOutExpo>();
+        case Easing::EaseInOutExpo: return function.template operator()<Easing::EaseInOutExpo>();
+        case Easing::EaseInCirc: return function.template operator()<Easing::EaseInCirc>();
+        case Easing::EaseOutCirc: return function.template operator()<Easing::EaseOutCirc>();
+        case Easing::EaseInOutCirc: return function.template operator()<Easing::EaseInOutCirc>();
+        case Easing::EaseInBack: return function.template operator()<Easing::EaseInBack>();
+        case Easing::EaseOutBack: return function.template operator()<Easing::EaseOutBack>();
+        case Easing::EaseInOutBack: return function.template operator()<Easing::EaseInOutBack>();
+        case Easing::EaseInElastic: return function.template operator()<Easing::EaseInElastic>();
+        case Easing::EaseOutElastic: return function.template operator()<Easing::EaseOutElastic>();
+        case Easing::EaseInOutElastic: return function.template operator()<Easing::EaseInOutElastic>();
+    }
+    return function.template operator()<Easing::None>();
+}
+
+bool EaseTable::isTabulated(Easing easing) {
+    switch (easing) {
+        case Easing::EaseInExpo:
+        case Easing::EaseOutExpo:
+        case Easing::EaseInOutExpo:
+        case Easing::EaseInBack:
+        case Easing::EaseOutBack:
+        case Easing::EaseInOutBack:
+        case Easing::EaseInElastic:
+        case Easing::EaseOutElastic:
+        case Easing::EaseInOutElastic:
+            return true;
+        default:
+            return false;
+    }
+}
+
+float EaseTable::eval(Easing easing, float x) {
+    const auto& samples = table(easing);
+
+    float position = std::clamp(x, 0.0f, 1.0f) * Resolution;
+    int index = std::min(static_cast<int>(position), Resolution - 1);
+    float fraction = position - index;
+    return samples[index] + (samples[index + 1] - samples[index]) * fraction;
+}
+
+void EaseTable::evaluate(Easing easing, const float* t, float* out, size_t count) {
+    const float* samples = table(easing).data();
+
+    for (size_t i = 0; i < count; i++) {
+        float position = std::clamp(t[i], 0.0f, 1.0f) * Resolution;
+        int index = std::min(static_cast<int>(position), Resolution - 1);
+        float fraction = position - index;
+        out[i] = samples[index] + (samples[index + 1] - samples[index]) * fraction;
+    }
+}
+
+const std::array<float, EaseTable::Resolution + 1>& EaseTable::table(Easing easing) {
+    static std::array<std::array<float, Resolution + 1>, static_cast<size_t>(Easing::EaseInOutElastic) + 1> tables = []() {
+        std::array<std::array<float, Resolution + 1>, static_cast<size_t>(Easing::EaseInOutElastic) + 1> result;
+        for (size_t e = 0; e < result.size(); e++) {
+            for (int i = 0; i <= Resolution; i++) {
+                result[e][i] = Easings::evaluate(static_cast<Easing>(e), static_cast<float>(i) / Resolution);
+            }
+        }
+        return result;
+    }();
+
+    return tables[static_cast<size_t>(easing)];
+}
+
+float Easings::evaluate(Easing easing, float t) {
+    return dispatch(easing, [t]<Easing E>() {
+        return Ease<E>::eval(t);
+    });
+}
+
+void Easings::evaluate(Easing easing, const float* t, float* out, size_t count, bool useTables) {
+    if (useTables && EaseTable::isTabulated(easing)) {
+        EaseTable::evaluate(easing, t, out, count);
+        return;
+    }
+
+    dispatch(easing, [t, out, count]<Easing E>() {
+        Ease<E>::evaluate(t, out, count);
+    });
+}
\ No newline at end of file
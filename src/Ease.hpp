@@ -0,0 +1,127 @@
+﻿#pragma once
+
+#include "Animation.hpp"
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+
+template<Easing E>
+struct Ease {
+    static constexpr float eval(float x) {
+        constexpr float pi = std::numbers::pi_v<float>;
+        constexpr float c1 = 1.70158f;
+        constexpr float c2 = c1 * 1.525f;
+        constexpr float c3 = c1 + 1.0f;
+        constexpr float c4 = (2.0f * pi) / 3.0f;
+        constexpr float c5 = (2.0f * pi) / 4.5f;
+
+        if constexpr (E == Easing::None || E == Easing::EaseLinear) {
+            return x;
+        } else if constexpr (E == Easing::EaseInSine) {
+            return 1.0f - std::cos((x * pi) / 2.0f);
+        } else if constexpr (E == Easing::EaseOutSine) {
+            return std::sin((x * pi) / 2.0f);
+        } else if constexpr (E == Easing::EaseInOutSine) {
+            return -(std::cos(pi * x) - 1.0f) / 2.0f;
+        } else if constexpr (E == Easing::EaseInQuad) {
+            return x * x;
+        } else if constexpr (E == Easing::EaseOutQuad) {
+            return 1.0f - (1.0f - x) * (1.0f - x);
+        } else if constexpr (E == Easing::EaseInOutQuad) {
+            float y = -2.0f * x + 2.0f;
+            return x < 0.5f ? 2.0f * x * x : 1.0f - y * y / 2.0f;
+        } else if constexpr (E == Easing::EaseInCubic) {
+            return x * x * x;
+        } else if constexpr (E == Easing::EaseOutCubic) {
+            float y = 1.0f - x;
+            return 1.0f - y * y * y;
+        } else if constexpr (E == Easing::EaseInOutCubic) {
+            float y = -2.0f * x + 2.0f;
+            return x < 0.5f ? 4.0f * x * x * x : 1.0f - y * y * y / 2.0f;
+        } else if constexpr (E == Easing::EaseInQuart) {
+            return x * x * x * x;
+        } else if constexpr (E == Easing::EaseOutQuart) {
+            float y = 1.0f - x;
+            return 1.0f - y * y * y * y;
+        } else if constexpr (E == Easing::EaseInOutQuart) {
+            float y = -2.0f * x + 2.0f;
+            return x < 0.5f ? 8.0f * x * x * x * x : 1.0f - y * y * y * y / 2.0f;
+        } else if constexpr (E == Easing::EaseInQuint) {
+            return x * x * x * x * x;
+        } else if constexpr (E == Easing::EaseOutQuint) {
+            float y = 1.0f - x;
+            return 1.0f - y * y * y * y * y;
+        } else if constexpr (E == Easing::EaseInOutQuint) {
+            float y = -2.0f * x + 2.0f;
+            return x < 0.5f ? 16.0f * x * x * x * x * x : 1.0f - y * y * y * y * y / 2.0f;
+        } else if constexpr (E == Easing::EaseInExpo) {
+            return x == 0.0f ? 0.0f : std::exp2(10.0f * x - 10.0f);
+        } else if constexpr (E == Easing::EaseOutExpo) {
+            return x == 1.0f ? 1.0f : 1.0f - std::exp2(-10.0f * x);
+        } else if constexpr (E == Easing::EaseInOutExpo) {
+            return x == 0.0f ? 0.0f
+                : x == 1.0f ? 1.0f
+                : x < 0.5f ? std::exp2(20.0f * x - 10.0f) / 2.0f
+                : (2.0f - std::exp2(-20.0f * x + 10.0f)) / 2.0f;
+        } else if constexpr (E == Easing::EaseInCirc) {
+            return 1.0f - std::sqrt(1.0f - x * x);
+        } else if constexpr (E == Easing::EaseOutCirc) {
+            return std::sqrt(1.0f - (x - 1.0f) * (x - 1.0f));
+        } else if constexpr (E == Easing::EaseInOutCirc) {
+            float y = -2.0f * x + 2.0f;
+            return x < 0.5f
+                ? (1.0f - std::sqrt(1.0f - 4.0f * x * x)) / 2.0f
+                : (std::sqrt(1.0f - y * y) + 1.0f) / 2.0f;
+        } else if constexpr (E == Easing::EaseInBack) {
+            return c3 * x * x * x - c1 * x * x;
+        } else if constexpr (E == Easing::EaseOutBack) {
+            float y = x - 1.0f;
+            return 1.0f + c3 * y * y * y + c1 * y * y;
+        } else if constexpr (E == Easing::EaseInOutBack) {
+            float y = 2.0f * x - 2.0f;
+            return x < 0.5f
+                ? (4.0f * x * x * ((c2 + 1.0f) * 2.0f * x - c2)) / 2.0f
+                : (y * y * ((c2 + 1.0f) * y + c2) + 2.0f) / 2.0f;
+        } else if constexpr (E == Easing::EaseInElastic) {
+            return x == 0.0f ? 0.0f
+                : x == 1.0f ? 1.0f
+                : -std::exp2(10.0f * x - 10.0f) * std::sin((x * 10.0f - 10.75f) * c4);
+        } else if constexpr (E == Easing::EaseOutElastic) {
+            return x == 0.0f ? 0.0f
+                : x == 1.0f ? 1.0f
+                : std::exp2(-10.0f * x) * std::sin((x * 10.0f - 0.75f) * c4) + 1.0f;
+        } else if constexpr (E == Easing::EaseInOutElastic) {
+            return x == 0.0f ? 0.0f
+                : x == 1.0f ? 1.0f
+                : x < 0.5f ? -(std::exp2(20.0f * x - 10.0f) * std::sin((20.0f * x - 11.125f) * c5)) / 2.0f
+                : (std::exp2(-20.0f * x + 10.0f) * std::sin((20.0f * x - 11.125f) * c5)) / 2.0f + 1.0f;
+        } else {
+            return x;
+        }
+    }
+
+    static void evaluate(const float* t, float* out, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = eval(t[i]);
+        }
+    }
+};
+
+class EaseTable {
+    public:
+        static constexpr int Resolution = 256;
+
+        static bool isTabulated(Easing easing);
+        static float eval(Easing easing, float x);
+        static void evaluate(Easing easing, const float* t, float* out, size_t count);
+
+    private:
+        static const std::array<float, Resolution + 1>& table(Easing easing);
+};
+
+class Easings {
+    public:
+        static float evaluate(Easing easing, float t);
+        static void evaluate(Easing easing, const float* t, float* out, size_t count, bool useTables = false);
+};
\ No newline at end of file
@@ -1,13 +1,18 @@
 ﻿#pragma once
 #include <string>
+#include <memory>
+#include <vector>
 
 class Font {
 
     public:
         std::string path;
         int handle;
+        std::shared_ptr<std::vector<unsigned char>> data;
+        float sdfSize = 0.0f;
         
     public:
         Font() = default;
         Font(std::string path, int handle) : path(path), handle(handle) {}
+        Font(std::string path, int handle, std::shared_ptr<std::vector<unsigned char>> data) : path(path), handle(handle), data(data) {}
 };
\ No newline at end of file
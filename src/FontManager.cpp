@@ -1,27 +1,96 @@
 #include "FontManager.hpp"
 #include "Renderer.hpp"
+#include "Window.hpp"
 #include <memory>
 #include <unordered_map>
 #include <filesystem>
+#include <fstream>
+#include <cstdlib>
+#include <mutex>
 
 std::unordered_map<std::string, std::shared_ptr<Font>>& FontManager::fonts() {
     static std::unordered_map<std::string, std::shared_ptr<Font>> m_fonts;
     return m_fonts;
 }
 
+std::unordered_map<std::string, std::weak_ptr<std::vector<unsigned char>>>& FontManager::fontData() {
+    static std::unordered_map<std::string, std::weak_ptr<std::vector<unsigned char>>> m_fontData;
+    return m_fontData;
+}
+
+std::mutex& FontManager::fontDataMutex() {
+    static std::mutex m_fontDataMutex;
+    return m_fontDataMutex;
+}
+
 std::shared_ptr<Font> FontManager::load(const std::string& name, const std::filesystem::path& filepath) {
     auto& m_fonts = fonts();
     auto it = m_fonts.find(name);
     if (it != m_fonts.end()) return it->second;
 
-    int handle = nvgCreateFont(Renderer::context, name.c_str(), filepath.string().c_str());
+    return load(name, filepath, loadData(filepath));
+}
+
+std::shared_ptr<Font> FontManager::load(const std::string& name, const std::filesystem::path& filepath, std::shared_ptr<std::vector<unsigned char>> data) {
+    auto& m_fonts = fonts();
+    auto it = m_fonts.find(name);
+    if (it != m_fonts.end()) return it->second;
+
+    if (!data) return nullptr;
+
+    int handle = nvgCreateFontMem(Renderer::context, name.c_str(), data->data(), static_cast<int>(data->size()), 0);
     if (handle == -1) return nullptr;
 
-    auto font = std::make_shared<Font>(filepath.string(), handle);
+    auto font = std::make_shared<Font>(filepath.string(), handle, data);
     m_fonts[name] = font;
     return font;
 }
 
+std::shared_ptr<std::vector<unsigned char>> FontManager::loadData(const std::filesystem::path& filepath) {
+    std::error_code error;
+    std::string key = std::filesystem::weakly_canonical(filepath, error).string();
+    if (error) key = filepath.string();
+
+    {
+        std::lock_guard<std::mutex> lock(fontDataMutex());
+        auto it = fontData().find(key);
+        if (it != fontData().end()) {
+            if (auto data = it->second.lock()) return data;
+        }
+    }
+
+    std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+    if (!file) return nullptr;
+
+    auto data = std::make_shared<std::vector<unsigned char>>(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(data->data()), data->size())) return nullptr;
+
+    std::lock_guard<std::mutex> lock(fontDataMutex());
+    auto& cached = fontData()[key];
+    if (auto existing = cached.lock()) return existing;
+
+    cached = data;
+    return data;
+}
+
+bool FontManager::addFallback(const std::string& name, const std::string& fallbackName) {
+    auto font = get(name);
+    auto fallback = get(fallbackName);
+    if (!font || !fallback) return false;
+
+    return nvgAddFallbackFontId(Renderer::context, font->handle, fallback->handle) != 0;
+}
+
+bool FontManager::enableSdf(std::shared_ptr<Font> font, float referenceSize) {
+    if (!font) return false;
+    if (!nvgFontSDF(Renderer::context, font->handle, referenceSize)) return false;
+
+    font->sdfSize = referenceSize;
+    Renderer::clearTextCache();
+    return true;
+}
+
 std::shared_ptr<Font> FontManager::get(const std::string& name) {
     auto& m_fonts = fonts();
     auto it = m_fonts.find(name);
@@ -33,11 +102,54 @@ void FontManager::unload(const std::string& name) {
     auto& m_fonts = fonts();
     auto it = m_fonts.find(name);
     if (it != m_fonts.end()) {
+        if (Renderer::context) {
+            nvgDeleteFont(Renderer::context, it->second->handle);
+            Renderer::clearTextCache();
+        }
         m_fonts.erase(it);
     }
 }
 
 void FontManager::unloadAll() {
     auto& m_fonts = fonts();
+    if (Renderer::context) {
+        for (auto& [name, font] : m_fonts) {
+            nvgDeleteFont(Renderer::context, font->handle);
+        }
+        Renderer::clearTextCache();
+    }
     m_fonts.clear();
+}
+
+void FontManager::prewarm(std::shared_ptr<Font> font, const std::vector<float>& sizes, const std::string& charset) {
+    if (!font) return;
+
+    for (float size : sizes) {
+        Renderer::prewarmText(charset, font, size, Window::getDevicePixelRatio());
+    }
+}
+
+bool FontManager::saveAtlas(const std::filesystem::path& filepath) {
+    int size = 0;
+    unsigned char* data = nvgSaveFontAtlas(Renderer::context, &size);
+    if (data == nullptr) return false;
+
+    std::ofstream file(filepath, std::ios::binary);
+    bool saved = file && file.write(reinterpret_cast<const char*>(data), size);
+    free(data);
+    return saved;
+}
+
+bool FontManager::loadAtlas(const std::filesystem::path& filepath) {
+    std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+
+    std::vector<unsigned char> data(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(data.data()), data.size())) return false;
+
+    if (!nvgLoadFontAtlas(Renderer::context, data.data(), static_cast<int>(data.size()))) return false;
+
+    Renderer::clearTextCache();
+    return true;
 }
\ No newline at end of file
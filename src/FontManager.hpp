@@ -3,15 +3,33 @@
 #include <filesystem>
 #include <unordered_map>
 #include <memory>
+#include <vector>
+#include <mutex>
 #include "Font.hpp"
 
 class FontManager {
     public:
         static std::shared_ptr<Font> load(const std::string& name, const std::filesystem::path& filepath);
+        static std::shared_ptr<Font> load(const std::string& name, const std::filesystem::path& filepath, std::shared_ptr<std::vector<unsigned char>> data);
         static std::shared_ptr<Font> get(const std::string& name);
         static void unload(const std::string& name);
         static void unloadAll();
 
+        static std::shared_ptr<std::vector<unsigned char>> loadData(const std::filesystem::path& filepath);
+        static bool addFallback(const std::string& name, const std::string& fallbackName);
+        // glyphs are rasterized once as distance fields at referenceSize and scaled to every size and zoom
+        static bool enableSdf(std::shared_ptr<Font> font, float referenceSize = DefaultSdfSize);
+
+        static void prewarm(std::shared_ptr<Font> font, const std::vector<float>& sizes, const std::string& charset = DefaultCharset);
+        static bool saveAtlas(const std::filesystem::path& filepath);
+        static bool loadAtlas(const std::filesystem::path& filepath);
+
+        static constexpr float DefaultSdfSize = 48.0f;
+        static inline const std::string DefaultCharset =
+            " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~";
+
     private:
         static std::unordered_map<std::string, std::shared_ptr<Font>>& fonts();
+        static std::unordered_map<std::string, std::weak_ptr<std::vector<unsigned char>>>& fontData();
+        static std::mutex& fontDataMutex();
 };
\ No newline at end of file
@@ -0,0 +1,165 @@
+#include "JobSystem.hpp"
+#include <algorithm>
+
+void JobSystem::init(int workerCount) {
+    if (running) {
+        return;
+    }
+
+    if (workerCount <= 0) {
+        workerCount = getAvailableWorkers();
+    }
+
+    // constructed after the static members, so destroyed before them
+    static ShutdownGuard guard;
+
+    workerCount = std::clamp(workerCount, 1, MaxWorkers);
+    stopping = false;
+    running = true;
+
+    for (int i = 1; i < workerCount; ++i) {
+        threads.emplace_back(workerLoop, i);
+    }
+}
+
+void JobSystem::shutdown() {
+    if (!running) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+
+    workAvailable.notify_all();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    threads.clear();
+    queue.clear();
+    freeJobs.clear();
+    jobs.clear();
+    running = false;
+}
+
+bool JobSystem::isRunning() {
+    return running;
+}
+
+int JobSystem::getWorkerCount() {
+    return static_cast<int>(threads.size()) + 1;
+}
+
+int JobSystem::getAvailableWorkers() {
+    if (running) {
+        return getWorkerCount();
+    }
+
+    return std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1, MaxWorkers);
+}
+
+JobSystem::Job* JobSystem::enqueue(TaskFunction task, int itemCount, int minRange, void* context, int workerLimit) {
+    if (itemCount <= 0) {
+        return nullptr;
+    }
+
+    int workers = std::min(getWorkerCount(), workerLimit);
+
+    if (workers <= 1) {
+        task(0, itemCount, 0, context);
+        return nullptr;
+    }
+
+    int blockCount = std::clamp(itemCount / std::max(minRange, 1), 1, workers * BlocksPerWorker);
+    int blockSize = (itemCount + blockCount - 1) / blockCount;
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    Job* job;
+    if (freeJobs.empty()) {
+        jobs.push_back(std::make_unique<Job>());
+        job = jobs.back().get();
+    } else {
+        job = freeJobs.back();
+        freeJobs.pop_back();
+    }
+
+    job->task = task;
+    job->context = context;
+    job->itemCount = itemCount;
+    job->blockSize = blockSize;
+    job->blockCount = (itemCount + blockSize - 1) / blockSize;
+    job->workerLimit = workers;
+    job->users = 0;
+    job->nextBlock = 0;
+    job->completedBlocks = 0;
+    queue.push_back(job);
+
+    lock.unlock();
+    workAvailable.notify_all();
+
+    return job;
+}
+
+void JobSystem::wait(Job* job) {
+    if (!job) {
+        return;
+    }
+
+    execute(*job, 0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    jobFinished.wait(lock, [job] {
+        return job->users == 0 && job->completedBlocks == job->blockCount;
+    });
+
+    std::erase(queue, job);
+    freeJobs.push_back(job);
+}
+
+void JobSystem::workerLoop(int workerIndex) {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+        Job* job = nullptr;
+        workAvailable.wait(lock, [&job, workerIndex] {
+            job = acquire(workerIndex);
+            return job || stopping;
+        });
+
+        if (!job) {
+            return;
+        }
+
+        job->users++;
+        lock.unlock();
+        execute(*job, workerIndex);
+        lock.lock();
+        job->users--;
+        jobFinished.notify_all();
+    }
+}
+
+JobSystem::Job* JobSystem::acquire(int workerIndex) {
+    for (Job* job : queue) {
+        if (workerIndex < job->workerLimit && job->nextBlock < job->blockCount) {
+            return job;
+        }
+    }
+
+    return nullptr;
+}
+
+void JobSystem::execute(Job& job, int workerIndex) {
+    int block;
+
+    while ((block = job.nextBlock.fetch_add(1)) < job.blockCount) {
+        int start = block * job.blockSize;
+        int end = std::min(start + job.blockSize, job.itemCount);
+        job.task(start, end, static_cast<uint32_t>(workerIndex), job.context);
+        job.completedBlocks.fetch_add(1);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+﻿#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class JobSystem {
+    public:
+        using TaskFunction = void(*)(int startIndex, int endIndex, uint32_t workerIndex, void* context);
+
+        static constexpr int MaxWorkers = 64;
+
+        struct Job {
+            TaskFunction task = nullptr;
+            void* context = nullptr;
+            int itemCount = 0;
+            int blockSize = 0;
+            int blockCount = 0;
+            int workerLimit = 0;
+            int users = 0;
+            std::atomic<int> nextBlock = 0;
+            std::atomic<int> completedBlocks = 0;
+        };
+
+        static void init(int workerCount = 0);
+        static void shutdown();
+        static bool isRunning();
+        static int getWorkerCount();
+        // workers init() would start, or the running count, without starting any threads
+        static int getAvailableWorkers();
+
+        static Job* enqueue(TaskFunction task, int itemCount, int minRange, void* context, int workerLimit = MaxWorkers);
+        static void wait(Job* job);
+
+    private:
+        static const int BlocksPerWorker = 4;
+
+        // joins the workers at exit when shutdown() was never called
+        struct ShutdownGuard {
+            ~ShutdownGuard() { shutdown(); }
+        };
+
+        static inline std::vector<std::thread> threads;
+        static inline std::vector<std::unique_ptr<Job>> jobs;
+        static inline std::vector<Job*> freeJobs;
+        static inline std::vector<Job*> queue;
+        static inline std::mutex mutex;
+        static inline std::condition_variable workAvailable;
+        static inline std::condition_variable jobFinished;
+        static inline bool running = false;
+        static inline bool stopping = false;
+
+        static void workerLoop(int workerIndex);
+        static Job* acquire(int workerIndex);
+        static void execute(Job& job, int workerIndex);
+};
\ No newline at end of file
@@ -0,0 +1,22 @@
+#include "Layer.hpp"
+#include "Renderer.hpp"
+#include "nanovg_bgfx.h"
+#include <algorithm>
+#include <cmath>
+
+Layer::Layer(Size size, float devicePixelRatio) : size(size), devicePixelRatio(devicePixelRatio) {
+    int width = std::max(1, static_cast<int>(std::ceil(size.width * devicePixelRatio)));
+    int height = std::max(1, static_cast<int>(std::ceil(size.height * devicePixelRatio)));
+    framebuffer = nvgluCreateFramebuffer(Renderer::context, width, height, NVG_IMAGE_NODELETE);
+}
+
+Layer::~Layer() {
+    if (framebuffer) {
+        nvgluDeleteFramebuffer(framebuffer);
+        framebuffer = nullptr;
+    }
+}
+
+int Layer::getImage() const {
+    return framebuffer ? framebuffer->image : 0;
+}
\ No newline at end of file
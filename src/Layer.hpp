@@ -0,0 +1,21 @@
+﻿#pragma once
+
+#include "api/Size.hpp"
+
+struct NVGLUframebuffer;
+
+class Layer {
+    public:
+        NVGLUframebuffer* framebuffer = nullptr;
+        Size size = Size(0.0f, 0.0f);
+        float devicePixelRatio = 1.0f;
+        bool valid = false;
+
+        Layer(Size size, float devicePixelRatio = 1.0f);
+        ~Layer();
+
+        Layer(const Layer&) = delete;
+        Layer& operator=(const Layer&) = delete;
+
+        int getImage() const;
+};
\ No newline at end of file
@@ -0,0 +1,265 @@
+#include "ParticleSystem.hpp"
+#include "Renderer.hpp"
+#include "api/World.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+ParticleSystem::ParticleSystem(size_t capacity) : capacity(0), random(std::random_device{}()) {
+    setCapacity(capacity);
+}
+
+ParticleSystem::ParticleSystem(const ParticleEmitter& emitter, size_t capacity) : emitter(emitter), capacity(0), random(std::random_device{}()) {
+    setCapacity(capacity);
+}
+
+void ParticleSystem::setEmitter(const ParticleEmitter& emitter) {
+    this->emitter = emitter;
+}
+
+ParticleEmitter& ParticleSystem::getEmitter() {
+    return emitter;
+}
+
+void ParticleSystem::setPosition(Point position) {
+    emitter.position = position;
+}
+
+void ParticleSystem::setEmitting(bool emitting) {
+    this->emitting = emitting;
+    emitAccumulator = 0.0f;
+}
+
+bool ParticleSystem::isEmitting() const {
+    return emitting;
+}
+
+void ParticleSystem::setWorld(World* world) {
+    this->world = world;
+}
+
+void ParticleSystem::emit(int amount) {
+    size_t available = capacity - count;
+    size_t spawnCount = std::min(static_cast<size_t>(std::max(amount, 0)), available);
+
+    for (size_t i = 0; i < spawnCount; ++i) {
+        spawn(count++);
+    }
+}
+
+void ParticleSystem::spawn(size_t index) {
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    float lifetime = emitter.lifetimeMin + (emitter.lifetimeMax - emitter.lifetimeMin) * unit(random);
+    float speed = emitter.speedMin + (emitter.speedMax - emitter.speedMin) * unit(random);
+    float angle = (emitter.direction + (unit(random) - 0.5f) * emitter.spread) * (std::numbers::pi_v<float> / 180.0f);
+
+    positionX[index] = emitter.position.x + (unit(random) - 0.5f) * emitter.area.width;
+    positionY[index] = emitter.position.y + (unit(random) - 0.5f) * emitter.area.height;
+    velocityX[index] = std::cos(angle) * speed;
+    velocityY[index] = std::sin(angle) * speed;
+    age[index] = 0.0f;
+    inverseLifetime[index] = 1000.0f / std::max(lifetime, 1.0f);
+}
+
+void ParticleSystem::update(float deltaTime) {
+    float deltaSeconds = deltaTime / 1000.0f;
+
+    if (emitting && emitter.rate > 0.0f) {
+        emitAccumulator += emitter.rate * deltaSeconds;
+        int amount = static_cast<int>(emitAccumulator);
+        emitAccumulator -= static_cast<float>(amount);
+        emit(amount);
+    }
+
+    if (count == 0) {
+        return;
+    }
+
+    integrate(deltaSeconds);
+
+    if (emitter.collide && world) {
+        collide(deltaSeconds);
+    }
+
+    removeDead();
+}
+
+void ParticleSystem::integrate(float deltaSeconds) {
+    const size_t n = count;
+    const float drag = 1.0f / (1.0f + emitter.damping * deltaSeconds);
+    const float gravityX = emitter.gravity.x * deltaSeconds;
+    const float gravityY = emitter.gravity.y * deltaSeconds;
+
+    float* __restrict px = positionX.data();
+    float* __restrict py = positionY.data();
+    float* __restrict vx = velocityX.data();
+    float* __restrict vy = velocityY.data();
+    float* __restrict ages = age.data();
+
+    for (size_t i = 0; i < n; ++i) {
+        vx[i] = vx[i] * drag + gravityX;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        vy[i] = vy[i] * drag + gravityY;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        ages[i] += deltaSeconds;
+    }
+
+    if (emitter.collide && world) {
+        return;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        px[i] += vx[i] * deltaSeconds;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        py[i] += vy[i] * deltaSeconds;
+    }
+}
+
+void ParticleSystem::collide(float deltaSeconds) {
+    const float surfaceOffset = 0.01f;
+    const float bounce = 1.0f + emitter.restitution;
+    b2WorldId worldId = world->getWorldId();
+    b2QueryFilter filter = b2DefaultQueryFilter();
+
+    b2AABB bounds = {{INFINITY, INFINITY}, {-INFINITY, -INFINITY}};
+    for (size_t i = 0; i < count; ++i) {
+        float x = positionX[i] + velocityX[i] * deltaSeconds;
+        float y = positionY[i] + velocityY[i] * deltaSeconds;
+        bounds.lowerBound.x = std::min({bounds.lowerBound.x, positionX[i], x});
+        bounds.lowerBound.y = std::min({bounds.lowerBound.y, positionY[i], y});
+        bounds.upperBound.x = std::max({bounds.upperBound.x, positionX[i], x});
+        bounds.upperBound.y = std::max({bounds.upperBound.y, positionY[i], y});
+    }
+
+    obstacles.clear();
+    b2World_OverlapAABB(worldId, bounds, filter, [](b2ShapeId shapeId, void* context) {
+        static_cast<std::vector<b2AABB>*>(context)->push_back(b2Shape_GetAABB(shapeId));
+        return true;
+    }, &obstacles);
+
+    size_t casts = 0;
+    size_t start = collisionCursor < count ? collisionCursor : 0;
+
+    for (size_t n = 0; n < count; ++n) {
+        size_t i = (start + n) % count;
+        float dx = velocityX[i] * deltaSeconds;
+        float dy = velocityY[i] * deltaSeconds;
+
+        if (dx == 0.0f && dy == 0.0f) {
+            continue;
+        }
+
+        if (casts >= emitter.collisionBudget || !nearObstacle(positionX[i], positionY[i], dx, dy)) {
+            positionX[i] += dx;
+            positionY[i] += dy;
+            continue;
+        }
+
+        ++casts;
+        collisionCursor = i + 1;
+
+        b2RayResult result = b2World_CastRayClosest(worldId, {positionX[i], positionY[i]}, {dx, dy}, filter);
+
+        if (!result.hit) {
+            positionX[i] += dx;
+            positionY[i] += dy;
+            continue;
+        }
+
+        float dot = velocityX[i] * result.normal.x + velocityY[i] * result.normal.y;
+        velocityX[i] -= bounce * dot * result.normal.x;
+        velocityY[i] -= bounce * dot * result.normal.y;
+        positionX[i] = result.point.x + result.normal.x * surfaceOffset;
+        positionY[i] = result.point.y + result.normal.y * surfaceOffset;
+    }
+}
+
+bool ParticleSystem::nearObstacle(float x, float y, float dx, float dy) const {
+    b2AABB path = {{std::min(x, x + dx), std::min(y, y + dy)}, {std::max(x, x + dx), std::max(y, y + dy)}};
+
+    for (const b2AABB& obstacle : obstacles) {
+        if (b2AABB_Overlaps(path, obstacle)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ParticleSystem::removeDead() {
+    size_t i = 0;
+
+    while (i < count) {
+        if (age[i] * inverseLifetime[i] < 1.0f) {
+            ++i;
+            continue;
+        }
+
+        --count;
+        positionX[i] = positionX[count];
+        positionY[i] = positionY[count];
+        velocityX[i] = velocityX[count];
+        velocityY[i] = velocityY[count];
+        age[i] = age[count];
+        inverseLifetime[i] = inverseLifetime[count];
+    }
+}
+
+void ParticleSystem::draw() {
+    if (count == 0) {
+        return;
+    }
+
+    instances.resize(count * FloatsPerParticle);
+
+    // size and color are interpolated from t on the GPU, only position and t are uploaded
+    const float* __restrict px = positionX.data();
+    const float* __restrict py = positionY.data();
+    const float* __restrict ages = age.data();
+    const float* __restrict inverse = inverseLifetime.data();
+    float* __restrict out = instances.data();
+
+    for (size_t i = 0; i < count; ++i) {
+        out[i * FloatsPerParticle + 0] = px[i];
+        out[i * FloatsPerParticle + 1] = py[i];
+        out[i * FloatsPerParticle + 2] = ages[i] * inverse[i];
+        out[i * FloatsPerParticle + 3] = 0.0f;
+    }
+
+    int texture = emitter.texture && emitter.texture->handle > 0 ? emitter.texture->handle : 0;
+
+    Renderer::drawQuads(instances.data(), static_cast<int>(count), emitter.startSize, emitter.endSize, emitter.startColor, emitter.endColor, texture);
+}
+
+void ParticleSystem::clear() {
+    count = 0;
+    emitAccumulator = 0.0f;
+}
+
+size_t ParticleSystem::getCount() const {
+    return count;
+}
+
+size_t ParticleSystem::getCapacity() const {
+    return capacity;
+}
+
+void ParticleSystem::setCapacity(size_t capacity) {
+    capacity = std::min(capacity, MaxCapacity);
+    this->capacity = capacity;
+    count = std::min(count, capacity);
+
+    positionX.resize(capacity);
+    positionY.resize(capacity);
+    velocityX.resize(capacity);
+    velocityY.resize(capacity);
+    age.resize(capacity);
+    inverseLifetime.resize(capacity);
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+﻿#pragma once
+
+#include "Texture.hpp"
+#include "api/Point.hpp"
+#include "api/Size.hpp"
+#include "api/Color.hpp"
+#include <box2d/box2d.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+class World;
+
+struct ParticleEmitter {
+    Point position;
+    Size area = Size(0.0f, 0.0f);
+    float rate = 100.0f;
+    float lifetimeMin = 1000.0f;
+    float lifetimeMax = 1000.0f;
+    float speedMin = 50.0f;
+    float speedMax = 100.0f;
+    float direction = -90.0f;
+    float spread = 360.0f;
+    Point gravity = Point(0.0f, 0.0f);
+    float damping = 0.0f;
+    float startSize = 4.0f;
+    float endSize = 0.0f;
+    Color startColor = Color::White;
+    Color endColor = Color(255, 255, 255, 0);
+    std::shared_ptr<Texture> texture;
+    bool collide = false;
+    float restitution = 0.5f;
+    size_t collisionBudget = 2048;
+};
+
+class ParticleSystem {
+    public:
+        static const size_t DefaultCapacity = 10000;
+        // Particles are drawn as one instanced quad call, 16 bytes each in bgfx's per-frame
+        // transient pool (6 MB by default), so one system stays at a third of it.
+        static constexpr size_t MaxCapacity = 131072;
+
+        ParticleSystem(size_t capacity = DefaultCapacity);
+        ParticleSystem(const ParticleEmitter& emitter, size_t capacity = DefaultCapacity);
+
+        void setEmitter(const ParticleEmitter& emitter);
+        ParticleEmitter& getEmitter();
+        void setPosition(Point position);
+        void setEmitting(bool emitting);
+        bool isEmitting() const;
+        void setWorld(World* world);
+
+        void emit(int count);
+        void update(float deltaTime);
+        void draw();
+        void clear();
+
+        size_t getCount() const;
+        size_t getCapacity() const;
+        void setCapacity(size_t capacity);
+
+    private:
+        static const int FloatsPerParticle = 4;
+
+        ParticleEmitter emitter;
+        World* world = nullptr;
+        bool emitting = true;
+        float emitAccumulator = 0.0f;
+        size_t capacity;
+        size_t count = 0;
+        size_t collisionCursor = 0;
+
+        std::vector<float> positionX;
+        std::vector<float> positionY;
+        std::vector<float> velocityX;
+        std::vector<float> velocityY;
+        std::vector<float> age;
+        std::vector<float> inverseLifetime;
+
+        std::vector<float> instances;
+        std::vector<b2AABB> obstacles;
+        std::mt19937 random;
+
+        void spawn(size_t index);
+        void integrate(float deltaSeconds);
+        void collide(float deltaSeconds);
+        bool nearObstacle(float x, float y, float dx, float dy) const;
+        void removeDead();
+};
\ No newline at end of file
@@ -8,11 +8,174 @@
 #include <memory>
 #include <numbers>
 #include <cmath>
+#include <algorithm>
 #include "Sprite.hpp"
 #include "Font.hpp"
+#include "Shape.hpp"
+#include "Layer.hpp"
 
 void Renderer::init() {
     context = nvgCreate(0, 0);
+    nvgTextScaleQuantization(context, DefaultTextScaleSteps);
+
+    const unsigned char white[4 * 4 * 4] = {
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+    };
+    whiteTexture = nvgCreateImageRGBA(context, 4, 4, 0, white);
+}
+
+void Renderer::setTextScaleQuantization(int stepsPerOctave) {
+    nvgTextScaleQuantization(context, stepsPerOctave);
+}
+
+void Renderer::beginFrame(bgfx::ViewId viewId, Size size, float devicePixelRatio) {
+    Renderer::devicePixelRatio = devicePixelRatio;
+    viewSize = size;
+    bindView(viewId);
+    nvgBeginFrame(context, size.width, size.height, devicePixelRatio);
+}
+
+void Renderer::endFrame() {
+    nvgEndFrame(context);
+
+    if (!pendingLayers.empty()) {
+        flushLayers();
+    }
+}
+
+void Renderer::frame() {
+    bgfx::frame();
+    nextLayerViewId = FirstLayerViewId;
+
+    frameIndex++;
+    if (frameIndex % TextRunEvictInterval == 0) {
+        evictTextRuns();
+    }
+}
+
+float Renderer::getDevicePixelRatio() {
+    return devicePixelRatio;
+}
+
+Rect Renderer::getVisibleRect() {
+    float transform[6];
+    float inverse[6];
+
+    nvgCurrentTransform(context, transform);
+
+    if (!nvgTransformInverse(inverse, transform)) {
+        return Rect(0.0F, 0.0F, viewSize);
+    }
+
+    const float corners[4][2] = {
+        { 0.0F, 0.0F },
+        { viewSize.width, 0.0F },
+        { viewSize.width, viewSize.height },
+        { 0.0F, viewSize.height }
+    };
+
+    float minX = 0.0F, minY = 0.0F, maxX = 0.0F, maxY = 0.0F;
+
+    for (int i = 0; i < 4; ++i) {
+        float x, y;
+        nvgTransformPoint(&x, &y, inverse, corners[i][0], corners[i][1]);
+
+        minX = i == 0 ? x : std::min(minX, x);
+        minY = i == 0 ? y : std::min(minY, y);
+        maxX = i == 0 ? x : std::max(maxX, x);
+        maxY = i == 0 ? y : std::max(maxY, y);
+    }
+
+    return Rect(minX, minY, maxX - minX, maxY - minY);
+}
+
+void Renderer::bindView(bgfx::ViewId viewId) {
+    bgfx::setViewMode(viewId, bgfx::ViewMode::Sequential);
+    bgfx::touch(viewId);
+    nvgSetViewId(context, viewId);
+}
+
+void Renderer::renderLayer(std::shared_ptr<Layer> layer, std::function<void()> callback) {
+
+    if (!layer || !layer->framebuffer) {
+        return;
+    }
+
+    for (auto& job : pendingLayers) {
+        if (job.layer == layer) {
+            job.callback = std::move(callback);
+            return;
+        }
+    }
+
+    pendingLayers.push_back({layer, std::move(callback)});
+}
+
+void Renderer::cancelLayer(std::shared_ptr<Layer> layer) {
+    std::erase_if(pendingLayers, [&layer](const LayerJob& job) { return job.layer == layer; });
+}
+
+void Renderer::flushLayers() {
+
+    std::vector<LayerJob> jobs;
+    jobs.swap(pendingLayers);
+
+    Size frameSize = viewSize;
+
+    for (auto& job : jobs) {
+
+        if (nextLayerViewId > LastLayerViewId) {
+            break;
+        }
+
+        bgfx::ViewId viewId = nextLayerViewId++;
+        std::shared_ptr<Layer> layer = job.layer;
+
+        nvgluSetViewFramebuffer(viewId, layer->framebuffer);
+        bgfx::setViewClear(viewId, BGFX_CLEAR_COLOR | BGFX_CLEAR_DEPTH | BGFX_CLEAR_STENCIL, 0x00000000, 1.0f, 0);
+        bindView(viewId);
+
+        viewSize = layer->size;
+        nvgBeginFrame(context, layer->size.width, layer->size.height, layer->devicePixelRatio);
+        job.callback();
+        nvgEndFrame(context);
+
+        layer->valid = true;
+    }
+
+    viewSize = frameSize;
+}
+
+void Renderer::drawLayer(std::shared_ptr<Layer> layer, Rect rect, float alpha) {
+
+    if (!layer || !layer->valid) {
+        return;
+    }
+
+    drawRenderTarget(layer->getImage(), rect, alpha);
+}
+
+void Renderer::drawRenderTarget(int image, Rect rect, float alpha) {
+
+    if (image == 0) {
+        return;
+    }
+
+    float y = rect.y;
+    float height = rect.height;
+
+    if (bgfx::getCaps()->originBottomLeft) {
+        y += height;
+        height = -height;
+    }
+
+    nvgBeginPath(context);
+    nvgRect(context, rect.x, rect.y, rect.width, rect.height);
+    nvgFillPaint(context, nvgImagePattern(context, rect.x, y, rect.width, height, 0.0f, image, alpha));
+    nvgFill(context);
 }
 
 void Renderer::drawLine(Point point1, Point point2, float strokeWidth, Color color) {
@@ -99,6 +262,144 @@ void Renderer::drawPolygon(const std::vector<Point>& points, Color color) {
     nvgFill(context);
 }
 
+void Renderer::drawTriangles(const float* vertices, int vertexCount, Color color, int texture) {
+
+    if (!vertices || vertexCount < 3) {
+        return;
+    }
+
+    nvgFillColor(context, color.toNVGColor());
+    nvgTriangles(context, texture != 0 ? texture : whiteTexture, vertices, vertexCount);
+}
+
+void Renderer::drawQuads(const float* instances, int count, float startSize, float endSize, Color startColor, Color endColor, int texture) {
+
+    if (!instances || count <= 0) {
+        return;
+    }
+
+    nvgFillColor(context, startColor.toNVGColor());
+    nvgQuads(context, texture != 0 ? texture : whiteTexture, instances, count, startSize, endSize, endColor.toNVGColor());
+}
+
+int Renderer::createTriangleBuffer(const float* vertices, int vertexCount) {
+
+    if (!vertices || vertexCount < 3) {
+        return 0;
+    }
+
+    return nvgCreateTriangleBuffer(context, vertices, vertexCount);
+}
+
+void Renderer::drawTriangleBuffer(int buffer, Color color, int texture) {
+
+    if (buffer == 0) {
+        return;
+    }
+
+    nvgFillColor(context, color.toNVGColor());
+    nvgTriangleBuffer(context, buffer, texture != 0 ? texture : whiteTexture);
+}
+
+void Renderer::deleteTriangleBuffer(int buffer) {
+
+    if (buffer == 0 || !context) {
+        return;
+    }
+
+    nvgDeleteTriangleBuffer(context, buffer);
+}
+
+std::shared_ptr<Shape> Renderer::createRectShape(Size size) {
+    return createShape([size]() {
+        nvgRect(context, 0.0f, 0.0f, size.width, size.height);
+        nvgClosePath(context);
+    });
+}
+
+std::shared_ptr<Shape> Renderer::createRoundedRectShape(Size size, float radius) {
+    return createShape([size, radius]() {
+        nvgRoundedRect(context, 0.0f, 0.0f, size.width, size.height, radius);
+    });
+}
+
+std::shared_ptr<Shape> Renderer::createCircleShape(float radius) {
+    return createShape([radius]() {
+        nvgCircle(context, 0.0f, 0.0f, radius);
+    });
+}
+
+std::shared_ptr<Shape> Renderer::createPolygonShape(const std::vector<Point>& points) {
+
+    if (points.size() < 3) {
+        return std::make_shared<Shape>();
+    }
+
+    return createShape([points]() {
+        nvgMoveTo(context, points[0].x, points[0].y);
+
+        for (size_t i = 1; i < points.size(); ++i) {
+            nvgLineTo(context, points[i].x, points[i].y);
+        }
+
+        nvgClosePath(context);
+    });
+}
+
+std::shared_ptr<Shape> Renderer::createShape(std::function<void()> path) {
+    auto shape = std::make_shared<Shape>(std::move(path));
+    buildShape(*shape, getShapeScale());
+    return shape;
+}
+
+void Renderer::buildShape(Shape& shape, float scale) {
+    if (shape.handle) {
+        nvgDeleteShape(context, shape.handle);
+        shape.handle = nullptr;
+    }
+
+    nvgSave(context);
+    nvgResetTransform(context);
+    nvgBeginPath(context);
+    shape.path();
+    shape.handle = nvgCreateShapeScaled(context, scale);
+    shape.scale = scale;
+    nvgBeginPath(context);
+    nvgRestore(context);
+}
+
+float Renderer::getShapeScale() {
+    float xform[6];
+    nvgCurrentTransform(context, xform);
+
+    float scale = (std::sqrt(xform[0] * xform[0] + xform[1] * xform[1]) + std::sqrt(xform[2] * xform[2] + xform[3] * xform[3])) * 0.5f;
+    if (scale <= 0.0f) {
+        return 1.0f;
+    }
+
+    float steps = static_cast<float>(Shape::ScaleSteps);
+    return std::exp2(std::round(std::log2(scale) * steps) / steps);
+}
+
+void Renderer::drawShape(std::shared_ptr<Shape> shape, Point point, Color color) {
+
+    if (!shape || !shape->path) {
+        return;
+    }
+
+    float scale = getShapeScale();
+    if (shape->scale != scale) {
+        buildShape(*shape, scale);
+    }
+
+    if (!shape->handle) {
+        return;
+    }
+
+    nvgFillColor(context, color.toNVGColor());
+    nvgFillShape(context, shape->handle, point.x, point.y);
+}
+
 void Renderer::drawTexture(std::shared_ptr<Texture> texture, Rect rect, float alpha) {
 
     if(!texture || texture->handle == 0) {
@@ -149,73 +450,175 @@ void Renderer::drawCircleTexture(std::shared_ptr<Texture> texture, Point point,
 
 void Renderer::drawSprite(std::shared_ptr<Sprite> sprite, Rect rect, int index) {
 
-    if(!sprite || sprite->texture->handle == 0) {
+    if(!sprite || !sprite->texture || sprite->texture->handle == 0) {
         return;
     }
 
     Size textureSize = sprite->texture->size;
-    Size spriteSize = sprite->size;
-    
-    float columnsPerRow = textureSize.width / textureSize.width;
+    Sprite::Frame frame = sprite->getFrame(index);
+
+    if (frame.sourceSize.width <= 0.0f || frame.sourceSize.height <= 0.0f) {
+        return;
+    }
+
+    float scaleX = rect.width / frame.sourceSize.width;
+    float scaleY = rect.height / frame.sourceSize.height;
 
-    float hx = (index % (int) columnsPerRow) * spriteSize.width;
-    float hy = static_cast<float>(std::floor(index / columnsPerRow)) * spriteSize.height;
+    float x = rect.x + frame.trim.x * scaleX;
+    float y = rect.y + frame.trim.y * scaleY;
+    float width = frame.trim.width * scaleX;
+    float height = frame.trim.height * scaleY;
 
-    float scaleRatio = rect.height / spriteSize.height;
+    NVGpaint paint;
+
+    if (frame.rotated) {
+        paint = nvgImagePattern(context, x - frame.source.y * scaleX, y + (frame.source.x + frame.trim.height) * scaleY,
+            textureSize.width * scaleY, textureSize.height * scaleX, -std::numbers::pi_v<float> / 2.0f, sprite->texture->handle, 1.0f);
+    } else {
+        paint = nvgImagePattern(context, x - frame.source.x * scaleX, y - frame.source.y * scaleY,
+            textureSize.width * scaleX, textureSize.height * scaleY, 0.0f, sprite->texture->handle, 1.0f);
+    }
 
     nvgBeginPath(context);
-    nvgRect(context, rect.x, rect.y, rect.width, rect.height);
-    nvgFillPaint(context, nvgImagePattern(context, rect.x + -hx * scaleRatio, rect.y + -hy * scaleRatio, 
-        textureSize.width * scaleRatio, textureSize.height * scaleRatio, 0.0f, sprite->texture->handle, 1.0f));
+    nvgRect(context, x, y, width, height);
+    nvgFillPaint(context, paint);
     nvgFill(context);
 }
 
-void Renderer::drawText(std::string text, Point point, std::shared_ptr<Font> font, Color color, float size) {
+void Renderer::drawSprite(std::shared_ptr<Sprite> sprite, Point point, int index, float scale) {
+
+    if(!sprite) {
+        return;
+    }
+
+    Sprite::Frame frame = sprite->getFrame(index);
+    float width = frame.sourceSize.width * scale;
+    float height = frame.sourceSize.height * scale;
+
+    drawSprite(sprite, Rect(point.x - frame.pivot.x * width, point.y - frame.pivot.y * height, width, height), index);
+}
+
+void Renderer::drawText(const std::string& text, Point point, std::shared_ptr<Font> font, Color color, float size) {
 
     nvgFontSize(context, size);
     nvgFontFaceId(context, font->handle);
     nvgTextAlign(context, NVG_ALIGN_LEFT | NVG_ALIGN_TOP);
     nvgFillColor(context, color.toNVGColor());
 
-    float ascender, descender, lineh;
+    NVGtextRun* run = getTextRun(text, font, size, NVG_ALIGN_LEFT | NVG_ALIGN_TOP);
+    float descender = 0.0f;
 
-    nvgTextMetrics(context, &ascender, &descender, &lineh);
-    nvgText(context, point.x, point.y + descender, text.c_str(), nullptr);
+    nvgTextRunMetrics(run, nullptr, &descender, nullptr);
+    nvgDrawTextRun(context, run, point.x, point.y + descender);
 }
 
-void Renderer::drawCenteredText(std::string text, Point point, std::shared_ptr<Font> font, Color color, float size) {
+void Renderer::drawCenteredText(const std::string& text, Point point, std::shared_ptr<Font> font, Color color, float size) {
 
     nvgFontSize(context, size);
     nvgFontFaceId(context, font->handle);
     nvgTextAlign(context, NVG_ALIGN_CENTER | NVG_ALIGN_MIDDLE);
     nvgFillColor(context, color.toNVGColor());
 
-    float ascender, descender, lineh;
+    NVGtextRun* run = getTextRun(text, font, size, NVG_ALIGN_CENTER | NVG_ALIGN_MIDDLE);
+    float lineh = 0.0f;
 
-    nvgTextMetrics(context, &ascender, &descender, &lineh);
-    nvgText(context, point.x, point.y + (lineh / 2.0f), text.c_str(), nullptr);
+    nvgTextRunMetrics(run, nullptr, nullptr, &lineh);
+    nvgDrawTextRun(context, run, point.x, point.y + (lineh / 2.0f));
 }
 
-Size Renderer::getTextSize(std::string text, std::shared_ptr<Font> font, float size) {
-
-    float bounds[4];
+void Renderer::drawAlignedText(const std::string& text, Point point, std::shared_ptr<Font> font, Color color, float size, int align) {
 
     nvgFontSize(context, size);
     nvgFontFaceId(context, font->handle);
-    nvgTextBounds(context, 0.0f, 0.0f, text.c_str(), nullptr, bounds);
-    nvgTextAlign(context, NVG_ALIGN_LEFT | NVG_ALIGN_MIDDLE);
+    nvgTextAlign(context, align);
+    nvgFillColor(context, color.toNVGColor());
+
+    nvgDrawTextRun(context, getTextRun(text, font, size, align), point.x, point.y);
+}
 
-    return Size(bounds[2] - bounds[0], bounds[3] - bounds[1]);
+Size Renderer::getTextSize(const std::string& text, std::shared_ptr<Font> font, float size) {
+    return measureText(text, font, size)->size;
 }
 
-float Renderer::getTextWidth(std::string text, std::shared_ptr<Font> font, float size) {
+float Renderer::getTextWidth(const std::string& text, std::shared_ptr<Font> font, float size) {
     return getTextSize(text, font, size).width;
 }
 
-float Renderer::getTextHeight(std::string text, std::shared_ptr<Font> font, float size) {
+float Renderer::getTextHeight(const std::string& text, std::shared_ptr<Font> font, float size) {
     return getTextSize(text, font, size).height;
 }
 
+float Renderer::getTextAdvance(const std::string& text, std::shared_ptr<Font> font, float size) {
+    return measureText(text, font, size)->advance;
+}
+
+void Renderer::getTextMetrics(std::shared_ptr<Font> font, float size, float& ascender, float& descender, float& lineHeight) {
+
+    nvgFontSize(context, size);
+    nvgFontFaceId(context, font->handle);
+    nvgTextAlign(context, NVG_ALIGN_LEFT | NVG_ALIGN_BASELINE);
+    nvgTextMetrics(context, &ascender, &descender, &lineHeight);
+}
+
+void Renderer::prewarmText(const std::string& text, std::shared_ptr<Font> font, float size, float devicePixelRatio) {
+
+    float previousRatio = nvgDevicePixelRatio(context, devicePixelRatio);
+    nvgSave(context);
+    nvgResetTransform(context);
+    nvgFontSize(context, size);
+    nvgFontFaceId(context, font->handle);
+    nvgTextAlign(context, NVG_ALIGN_LEFT | NVG_ALIGN_TOP);
+    nvgDeleteTextRun(context, nvgCreateTextRun(context, text.c_str(), nullptr));
+    nvgRestore(context);
+    nvgDevicePixelRatio(context, previousRatio);
+}
+
+void Renderer::clearTextCache() {
+    textRuns.clear();
+}
+
+std::shared_ptr<Renderer::TextRunEntry> Renderer::getTextRunEntry(const TextRunCacheKey& key) {
+    auto entry = textRuns.getOrCreate(key, []() {
+        return std::make_shared<TextRunEntry>();
+    });
+    entry->lastUsedFrame = frameIndex;
+    return entry;
+}
+
+NVGtextRun* Renderer::getTextRun(const std::string& text, std::shared_ptr<Font> font, float size, int align) {
+    auto entry = getTextRunEntry(TextRunCacheKey(text, font->handle, size, align));
+
+    if (!nvgTextRunValid(context, entry->run)) {
+        nvgDeleteTextRun(context, entry->run);
+        entry->run = nvgCreateTextRun(context, text.c_str(), nullptr);
+    }
+
+    return entry->run;
+}
+
+std::shared_ptr<Renderer::TextRunEntry> Renderer::measureText(const std::string& text, std::shared_ptr<Font> font, float size) {
+    auto entry = getTextRunEntry(TextRunCacheKey(text, font->handle, size));
+    if (entry->measured) {
+        return entry;
+    }
+
+    float bounds[4];
+
+    nvgFontSize(context, size);
+    nvgFontFaceId(context, font->handle);
+    nvgTextAlign(context, NVG_ALIGN_LEFT | NVG_ALIGN_MIDDLE);
+    entry->advance = nvgTextBounds(context, 0.0f, 0.0f, text.c_str(), nullptr, bounds);
+    entry->size = Size(bounds[2] - bounds[0], bounds[3] - bounds[1]);
+    entry->measured = true;
+    return entry;
+}
+
+void Renderer::evictTextRuns() {
+    textRuns.removeIf([](const TextRunCacheKey& key, const std::shared_ptr<TextRunEntry>& entry) {
+        return frameIndex - entry->lastUsedFrame > TextRunLifetime;
+    });
+}
+
 void Renderer::translate(Point point) {
     if(point.x != 0.0f || point.y != 0.0f) {
         nvgTranslate(context, point.x, point.y);
@@ -312,7 +715,14 @@ void Renderer::resetScisor() {
 }
 
 void Renderer::shutdown() {
+    pendingLayers.clear();
+    textRuns.clear();
+
     if (context) {
+        if (whiteTexture != 0) {
+            nvgDeleteImage(context, whiteTexture);
+            whiteTexture = 0;
+        }
         nvgDelete(context);
         context = nullptr;
     }
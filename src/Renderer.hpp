@@ -1,10 +1,15 @@
 #pragma once
 #include "Texture.hpp"
 #include "nanovg.h"
+#include "bgfx/bgfx.h"
 #include <memory>
+#include <functional>
+#include <vector>
 #include "api/Point.hpp"
 #include "api/Rect.hpp"
 #include "api/Size.hpp"
+#include "api/TextRunCacheKey.hpp"
+#include <string>
 
 class Color;
 class Texture;
@@ -13,13 +18,30 @@ class Font;
 class Point;
 class Rect;
 class Size;
+class Shape;
+class Layer;
 
 class Renderer {
     public:
         static inline NVGcontext* context = nullptr;
+
+        // views from FirstLayerViewId up are reserved for layers rendered after the frame
+        static constexpr bgfx::ViewId FirstLayerViewId = 128;
+        static constexpr bgfx::ViewId LastLayerViewId = 255;
+        static constexpr bgfx::ViewId LastSceneViewId = FirstLayerViewId - 1;
         
         static void init();
 
+        static void beginFrame(bgfx::ViewId viewId, Size size, float devicePixelRatio);
+        static void endFrame();
+        static void frame();
+        static float getDevicePixelRatio();
+        static Rect getVisibleRect();
+
+        static void renderLayer(std::shared_ptr<Layer> layer, std::function<void()> callback);
+        static void cancelLayer(std::shared_ptr<Layer> layer);
+        static void drawLayer(std::shared_ptr<Layer> layer, Rect rect, float alpha = 1.0F);
+
         static void drawLine(Point point1, Point point2, float strokeWidth, Color color);
         static void drawRect(Rect rect, Color color);
         static void drawRoundedRect(Rect rect, float radius, Color color);
@@ -29,19 +51,41 @@ class Renderer {
         static void drawArc(Point point, float radius, float startAngle, float endAngle, float strokeWidth, Color color);
         static void drawTriangle(Point point1, Point point2, Point point3, Color color);
         static void drawPolygon(const std::vector<Point>& points, Color color);
+        static void drawTriangles(const float* vertices, int vertexCount, Color color, int texture = 0);
+        // instances are x, y, t, unused; t in 0..1 picks size and color between the start and end values
+        static void drawQuads(const float* instances, int count, float startSize, float endSize, Color startColor, Color endColor, int texture = 0);
+        // static x, y, u, v triangles uploaded once, drawn with the current transform applied on the GPU
+        static int createTriangleBuffer(const float* vertices, int vertexCount);
+        static void drawTriangleBuffer(int buffer, Color color, int texture = 0);
+        static void deleteTriangleBuffer(int buffer);
+
+        static std::shared_ptr<Shape> createRectShape(Size size);
+        static std::shared_ptr<Shape> createRoundedRectShape(Size size, float radius);
+        static std::shared_ptr<Shape> createCircleShape(float radius);
+        static std::shared_ptr<Shape> createPolygonShape(const std::vector<Point>& points);
+        static void drawShape(std::shared_ptr<Shape> shape, Point point, Color color);
 
         static void drawTexture(std::shared_ptr<Texture> texture, Rect rect, float alpha = 1.0F);
         static void drawTexture(int texture, Rect rect, float alpha = 1.0F);
+        // draws the color image of an offscreen framebuffer, flipped on bottom-left origin backends
+        static void drawRenderTarget(int image, Rect rect, float alpha = 1.0F);
         static void drawRoundedTexture(std::shared_ptr<Texture> texture, Rect rect, float radius, float alpha = 1.0F);
         static void drawCircleTexture(std::shared_ptr<Texture> texture, Point point, float radius, float alpha = 1.0F);
         static void drawSprite(std::shared_ptr<class Sprite> sprite, Rect rect, int index);
+        static void drawSprite(std::shared_ptr<class Sprite> sprite, Point point, int index, float scale = 1.0F);
 
-        static void drawText(std::string text, Point point, std::shared_ptr<Font> font, Color color, float size);
-        static void drawCenteredText(std::string text, Point point, std::shared_ptr<Font> font, Color color, float size);
+        static void drawText(const std::string& text, Point point, std::shared_ptr<Font> font, Color color, float size);
+        static void drawCenteredText(const std::string& text, Point point, std::shared_ptr<Font> font, Color color, float size);
+        static void drawAlignedText(const std::string& text, Point point, std::shared_ptr<Font> font, Color color, float size, int align);
 
-        static Size getTextSize(std::string text, std::shared_ptr<Font> font, float size);
-        static float getTextWidth(std::string text, std::shared_ptr<Font> font, float size);
-        static float getTextHeight(std::string text, std::shared_ptr<Font> font, float size);
+        static Size getTextSize(const std::string& text, std::shared_ptr<Font> font, float size);
+        static float getTextWidth(const std::string& text, std::shared_ptr<Font> font, float size);
+        static float getTextHeight(const std::string& text, std::shared_ptr<Font> font, float size);
+        static float getTextAdvance(const std::string& text, std::shared_ptr<Font> font, float size);
+        static void getTextMetrics(std::shared_ptr<Font> font, float size, float& ascender, float& descender, float& lineHeight);
+        static void prewarmText(const std::string& text, std::shared_ptr<Font> font, float size, float devicePixelRatio);
+        static void clearTextCache();
+        static void setTextScaleQuantization(int stepsPerOctave);
 
         static void clear(Size size, Color color);
         
@@ -59,4 +103,47 @@ class Renderer {
         static void resetScisor();
 
         static void shutdown();
+
+    private:
+        struct LayerJob {
+            std::shared_ptr<Layer> layer;
+            std::function<void()> callback;
+        };
+
+        struct TextRunEntry {
+            NVGtextRun* run = nullptr;
+            Size size;
+            float advance = 0.0f;
+            bool measured = false;
+            unsigned long long lastUsedFrame = 0;
+
+            ~TextRunEntry() {
+                if (run) nvgDeleteTextRun(context, run);
+            }
+        };
+
+        using TextRunCache = CacheManager<TextRunCacheKey, std::shared_ptr<TextRunEntry>, TextRunCacheKeyHash>;
+
+        static inline std::vector<LayerJob> pendingLayers;
+        static inline bgfx::ViewId nextLayerViewId = FirstLayerViewId;
+        static inline float devicePixelRatio = 1.0F;
+        static inline Size viewSize;
+        static inline int whiteTexture = 0;
+
+        static const int DefaultTextScaleSteps = 4;
+        static const unsigned long long TextRunLifetime = 300;
+        static const unsigned long long TextRunEvictInterval = 60;
+
+        static inline TextRunCache textRuns;
+        static inline unsigned long long frameIndex = 0;
+
+        static void bindView(bgfx::ViewId viewId);
+        static void flushLayers();
+        static std::shared_ptr<TextRunEntry> getTextRunEntry(const TextRunCacheKey& key);
+        static NVGtextRun* getTextRun(const std::string& text, std::shared_ptr<Font> font, float size, int align);
+        static std::shared_ptr<TextRunEntry> measureText(const std::string& text, std::shared_ptr<Font> font, float size);
+        static void evictTextRuns();
+        static std::shared_ptr<Shape> createShape(std::function<void()> path);
+        static void buildShape(Shape& shape, float scale);
+        static float getShapeScale();
 };
\ No newline at end of file
@@ -47,10 +47,29 @@ void ResourceLoader::start(size_t threadCount) {
     }
 }
 
+void ResourceLoader::update() {
+    registerFonts();
+}
+
+void ResourceLoader::registerFonts() {
+    std::vector<PendingFont> fonts;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        fonts.swap(pendingFonts_);
+    }
+
+    for (auto& font : fonts) {
+        const auto& t = tasks_[font.task];
+        FontManager::load(t.name, t.path, font.data);
+        ++completed_;
+    }
+}
+
 void ResourceLoader::wait() {
     for (auto& w : workers_) {
         if (w.joinable()) w.join();
     }
+    update();
 }
 
 float ResourceLoader::getProgress() const {
@@ -75,8 +94,10 @@ void ResourceLoader::runRange(size_t begin, size_t end) {
                 break;
             }
             case Type::Font: {
-                FontManager::load(t.name, t.path);
-                break;
+                auto data = FontManager::loadData(t.path);
+                std::lock_guard<std::mutex> lock(pendingMutex_);
+                pendingFonts_.push_back({i, data});
+                continue;
             }
             case Type::Sprite: {
                 SpriteManager::load(t.name, t.path, t.width, t.height);
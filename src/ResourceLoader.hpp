@@ -4,6 +4,8 @@
 #include <filesystem>
 #include <atomic>
 #include <thread>
+#include <mutex>
+#include <memory>
 
 class ResourceLoader {
 public:
@@ -16,6 +18,10 @@ public:
     void addAudio(const std::string& name, const std::filesystem::path& path);
 
     void start(size_t threadCount = 1);
+    // Registers fonts decoded by the workers with nanovg, call it every frame on the render thread.
+    // Fonts count as completed only once registered, so getProgress() and isFinished() advance
+    // past them only while update() is pumped.
+    void update();
     void wait();
     float getProgress() const;
     bool isFinished() const;
@@ -33,10 +39,18 @@ private:
     };
 
     std::vector<Task> tasks_;
+    struct PendingFont {
+        size_t task;
+        std::shared_ptr<std::vector<unsigned char>> data;
+    };
+
     std::atomic<size_t> completed_;
     std::atomic<bool> started_;
     std::vector<std::thread> workers_;
+    std::vector<PendingFont> pendingFonts_;
+    std::mutex pendingMutex_;
 
+    void registerFonts();
     void run();
     void runRange(size_t begin, size_t end);
 };
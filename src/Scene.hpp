@@ -2,6 +2,7 @@
 
 #include "Camera.hpp"
 #include "api/Point.hpp"
+#include "bgfx/bgfx.h"
 #include <string>
 
 class Window;
@@ -32,6 +33,10 @@ class Scene {
         virtual void onExit() {}
 
         virtual bool shouldPause() const { return false; }
+        virtual bool isOpaque() const { return false; }
+        virtual bool shouldSnapshotBackground() const { return false; }
+        // ids above Renderer::LastSceneViewId are reserved for layers and get clamped
+        virtual bgfx::ViewId getViewId() const { return 0; }
 
     protected:
         Camera camera;
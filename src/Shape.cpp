@@ -0,0 +1,9 @@
+#include "Shape.hpp"
+#include "Renderer.hpp"
+
+Shape::~Shape() {
+    if (handle) {
+        nvgDeleteShape(Renderer::context, handle);
+        handle = nullptr;
+    }
+}
\ No newline at end of file
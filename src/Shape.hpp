@@ -0,0 +1,23 @@
+﻿#pragma once
+
+#include "nanovg.h"
+#include <functional>
+
+// Geometry is tessellated for the transform scale it is drawn at, rounded to ScaleSteps per octave.
+// Drawing at another rounded scale rebuilds it, so a shape under an animated zoom is rebuilt once per
+// step and reused in between. Within a step curves and edges are slightly coarser or softer.
+class Shape {
+    public:
+        static const int ScaleSteps = 2;
+
+        NVGshape* handle = nullptr;
+        float scale = 0.0f;
+        std::function<void()> path;
+
+        Shape() = default;
+        Shape(std::function<void()> path) : path(std::move(path)) {}
+        ~Shape();
+
+        Shape(const Shape&) = delete;
+        Shape& operator=(const Shape&) = delete;
+};
\ No newline at end of file
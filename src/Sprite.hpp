@@ -1,15 +1,58 @@
 ﻿#pragma once
 
 #include "Texture.hpp"
+#include "api/Point.hpp"
+#include "api/Rect.hpp"
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 class Sprite {
     public:
+        struct Frame {
+            Rect source;
+            Rect trim;
+            Size sourceSize;
+            Point pivot = Point(0.5f, 0.5f);
+            bool rotated = false;
+        };
+
         std::shared_ptr<Texture> texture;
         Size size = Size(0.0f, 0.0f);
+        std::vector<Frame> frames;
+        std::unordered_map<std::string, int> frameIndices;
         
         Sprite() = default;
         
         Sprite(std::shared_ptr<Texture> texture, Size size)
          : texture(texture), size(size) {}
+
+        Sprite(std::shared_ptr<Texture> texture, Size size, std::vector<Frame> frames)
+         : texture(texture), size(size), frames(std::move(frames)) {}
+
+        int getFrameCount() const {
+            if (!frames.empty()) return static_cast<int>(frames.size());
+            if (!texture || size.width <= 0.0f || size.height <= 0.0f) return 0;
+            return static_cast<int>(texture->size.width / size.width) * static_cast<int>(texture->size.height / size.height);
+        }
+
+        int getFrameIndex(const std::string& name) const {
+            auto it = frameIndices.find(name);
+            return it != frameIndices.end() ? it->second : -1;
+        }
+
+        Frame getFrame(int index) const {
+            if (!frames.empty()) {
+                return frames[std::clamp(index, 0, static_cast<int>(frames.size()) - 1)];
+            }
+
+            Frame frame;
+            int columnsPerRow = texture && size.width > 0.0f ? std::max(static_cast<int>(texture->size.width / size.width), 1) : 1;
+            frame.source = Rect((index % columnsPerRow) * size.width, (index / columnsPerRow) * size.height, size.width, size.height);
+            frame.trim = Rect(0.0f, 0.0f, size.width, size.height);
+            frame.sourceSize = size;
+            return frame;
+        }
 };
\ No newline at end of file
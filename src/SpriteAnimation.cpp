@@ -1,96 +1,80 @@
 #include "SpriteAnimation.hpp"
+#include "AnimationClipManager.hpp"
+#include "AnimationSystem.hpp"
 #include "Sprite.hpp"
-#include "Window.hpp"
 #include "Renderer.hpp"
 #include "api/Rect.hpp"
 #include <memory>
 
 SpriteAnimation::SpriteAnimation(std::shared_ptr<Sprite> sprite)
-    : timer(0.0f), currentFrame(0), finished(false), sprite(sprite) {}
+    : slot(AnimationSystem::add(this)), sprite(sprite) {}
 
-void SpriteAnimation::addAnimation(const std::string& name, bool loop) {
-    animations[name] = Animation();
-    animations[name].loop = loop;
-    
-    if (currentAnimationName.empty()) {
-        currentAnimationName = name;
-    }
+SpriteAnimation::~SpriteAnimation() {
+    AnimationSystem::remove(slot);
 }
 
-void SpriteAnimation::addFrame(const std::string& animationName, int index, float duration) {
-    auto it = animations.find(animationName);
-    if (it != animations.end()) {
-        it->second.frames.push_back({duration, index});
+void SpriteAnimation::setCurrentAnimation(const std::string& name) {
+    auto& state = AnimationSystem::states[slot];
+    if (state.clip && state.clip->getName() == name) return;
+
+    auto clip = AnimationClipManager::get(name);
+    if (clip) {
+        setClip(clip);
     }
 }
 
-void SpriteAnimation::setCurrentAnimation(const std::string& name) {
-    auto it = animations.find(name);
-    if (it != animations.end() && currentAnimationName != name) {
-        currentAnimationName = name;
-        reset();
+void SpriteAnimation::setCurrentAnimation(AnimationClip::Id id) {
+    auto& state = AnimationSystem::states[slot];
+    if (state.clip && state.clip->getId() == id) return;
+
+    auto clip = AnimationClipManager::get(id);
+    if (clip) {
+        setClip(clip);
     }
 }
 
-void SpriteAnimation::update() {
-    if (animations.empty() || currentAnimationName.empty() || finished) return;
-    
-    auto& currentAnimation = animations[currentAnimationName];
-    if (currentAnimation.frames.empty()) return;
-    
-    timer += Window::getDeltaTime() / 1000.0f;
-    while (timer >= currentAnimation.frames[currentFrame].duration) {
-        timer -= currentAnimation.frames[currentFrame].duration;
-        currentFrame++;
-        if (currentFrame >= currentAnimation.frames.size()) {
-            if (currentAnimation.loop) {
-                currentFrame = 0;
-            } else {
-                currentFrame = currentAnimation.frames.size() - 1;
-                finished = true;
-                break;
-            }
-        }
-    }
+void SpriteAnimation::setClip(std::shared_ptr<const AnimationClip> clip) {
+    AnimationSystem::states[slot].clip = std::move(clip);
+    reset();
 }
 
 int SpriteAnimation::getCurrentFrameIndex() const {
-    if (animations.empty() || currentAnimationName.empty()) return 0;
+    const auto& state = AnimationSystem::states[slot];
+    if (!state.clip || state.clip->getFrames().empty()) return 0;
     
-    auto it = animations.find(currentAnimationName);
-    if (it == animations.end() || it->second.frames.empty()) return 0;
-    
-    return it->second.frames[currentFrame].frameIndex;
+    return state.clip->getFrames()[state.frame].frameIndex;
 }
 
 void SpriteAnimation::reset() {
-    timer = 0.0f;
-    currentFrame = 0;
-    finished = false;
+    auto& state = AnimationSystem::states[slot];
+    state.timer = 0.0f;
+    state.frame = 0;
+    state.finished = false;
 }
 
 void SpriteAnimation::resetAnimation(const std::string& name) {
-    auto it = animations.find(name);
-    if (it != animations.end()) {
-        if (currentAnimationName == name) {
-            reset();
-        }
+    const auto& state = AnimationSystem::states[slot];
+    if (state.clip && state.clip->getName() == name) {
+        reset();
     }
 }
 
 bool SpriteAnimation::isFinished() const {
-    return finished;
+    return AnimationSystem::states[slot].finished;
 }
 
 std::string SpriteAnimation::getCurrentAnimationName() const {
-    return currentAnimationName;
+    const auto& state = AnimationSystem::states[slot];
+    return state.clip ? state.clip->getName() : std::string();
+}
+
+std::shared_ptr<const AnimationClip> SpriteAnimation::getCurrentAnimation() const {
+    return AnimationSystem::states[slot].clip;
 }
 
 void SpriteAnimation::draw(Rect rect) const {
-    if (animations.empty() || currentAnimationName.empty()) return;
-    
-    auto it = animations.find(currentAnimationName);
-    if (it == animations.end() || it->second.frames.empty()) return;
+    const auto& state = AnimationSystem::states[slot];
+    if (!state.clip || state.clip->getFrames().empty()) return;
     
     Renderer::drawSprite(sprite, rect, getCurrentFrameIndex());
-}
+}
\ No newline at end of file
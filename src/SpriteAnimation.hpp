@@ -1,32 +1,23 @@
 ﻿#pragma once
 #include <memory>
-#include <vector>
-#include <map>
 #include <string>
 #include "Sprite.hpp"
+#include "AnimationClip.hpp"
 
 class Rect;
 
 class SpriteAnimation {
     public:
-        struct AnimationFrame {
-            float duration;
-            int frameIndex;
-        };
-        
-        struct Animation {
-            std::vector<AnimationFrame> frames;
-            bool loop;
-            
-            Animation() : loop(true) {}
-        };
+        // draws nothing until a clip is selected with setCurrentAnimation
         SpriteAnimation(std::shared_ptr<Sprite> sprite);
+        ~SpriteAnimation();
+
+        SpriteAnimation(const SpriteAnimation&) = delete;
+        SpriteAnimation& operator=(const SpriteAnimation&) = delete;
         
-        void addAnimation(const std::string& name, bool loop = true);
-        void addFrame(const std::string& animationName, int index, float duration);
         void setCurrentAnimation(const std::string& name);
+        void setCurrentAnimation(AnimationClip::Id id);
         
-        void update();
         int getCurrentFrameIndex() const;
         void reset();
         void resetAnimation(const std::string& name);
@@ -34,12 +25,13 @@ class SpriteAnimation {
         void draw(Rect rect) const;
         
         std::string getCurrentAnimationName() const;
+        std::shared_ptr<const AnimationClip> getCurrentAnimation() const;
     
     private:
-        std::map<std::string, Animation> animations;
-        std::string currentAnimationName;
-        float timer;
-        size_t currentFrame;
-        bool finished;
+        size_t slot;
         std::shared_ptr<Sprite> sprite;
+
+        void setClip(std::shared_ptr<const AnimationClip> clip);
+
+        friend class AnimationSystem;
 };
\ No newline at end of file
@@ -6,6 +6,8 @@
 #include <memory>
 #include <unordered_map>
 #include <filesystem>
+#include <fstream>
+#include <nlohmann/json.hpp>
 
 std::unordered_map<std::string, std::shared_ptr<Sprite>>& SpriteManager::sprites() {
     static std::unordered_map<std::string, std::shared_ptr<Sprite>> m_sprites;
@@ -17,6 +19,83 @@ std::shared_ptr<Sprite> SpriteManager::load(const std::string& name, const std::
     auto it = m_sprites.find(name);
     if (it != m_sprites.end()) return it->second;
 
+    auto texture = loadTexture(filepath);
+    if (!texture) return nullptr;
+
+    auto sprite = std::make_shared<Sprite>(texture, Size(static_cast<float>(width), static_cast<float>(height)));
+    m_sprites[name] = sprite;
+    return sprite;
+}
+
+std::shared_ptr<Sprite> SpriteManager::loadSheet(const std::string& name, const std::filesystem::path& jsonPath) {
+    auto& m_sprites = sprites();
+    auto it = m_sprites.find(name);
+    if (it != m_sprites.end()) return it->second;
+
+    std::ifstream file(jsonPath);
+    if (!file) return nullptr;
+
+    nlohmann::ordered_json json = nlohmann::ordered_json::parse(file, nullptr, false);
+    if (json.is_discarded() || !json.contains("frames") || !json.contains("meta")) return nullptr;
+
+    auto readRect = [](const nlohmann::ordered_json& value) {
+        return Rect(value.value("x", 0.0f), value.value("y", 0.0f), value.value("w", 0.0f), value.value("h", 0.0f));
+    };
+
+    std::vector<Sprite::Frame> frames;
+    std::unordered_map<std::string, int> frameIndices;
+
+    auto addFrame = [&](const std::string& filename, const nlohmann::ordered_json& value) {
+        if (!value.contains("frame")) return;
+
+        Sprite::Frame frame;
+        frame.source = readRect(value["frame"]);
+        frame.rotated = value.value("rotated", false);
+        frame.trim = value.contains("spriteSourceSize") ? readRect(value["spriteSourceSize"]) : Rect(0.0f, 0.0f, frame.source.width, frame.source.height);
+
+        if (value.contains("sourceSize")) {
+            frame.sourceSize = Size(value["sourceSize"].value("w", 0.0f), value["sourceSize"].value("h", 0.0f));
+        } else {
+            frame.sourceSize = Size(frame.source.width, frame.source.height);
+        }
+
+        if (value.contains("pivot")) {
+            frame.pivot = Point(value["pivot"].value("x", 0.5f), value["pivot"].value("y", 0.5f));
+        }
+
+        if (!filename.empty()) {
+            frameIndices[filename] = static_cast<int>(frames.size());
+        }
+
+        frames.push_back(frame);
+    };
+
+    const auto& framesJson = json["frames"];
+
+    if (framesJson.is_array()) {
+        for (const auto& value : framesJson) {
+            addFrame(value.value("filename", std::string()), value);
+        }
+    } else if (framesJson.is_object()) {
+        for (const auto& [filename, value] : framesJson.items()) {
+            addFrame(filename, value);
+        }
+    }
+
+    if (frames.empty()) return nullptr;
+
+    std::filesystem::path imagePath = jsonPath.parent_path() / json["meta"].value("image", std::string());
+    auto texture = loadTexture(imagePath);
+    if (!texture) return nullptr;
+
+    Size size = frames.front().sourceSize;
+    auto sprite = std::make_shared<Sprite>(texture, size, std::move(frames));
+    sprite->frameIndices = std::move(frameIndices);
+    m_sprites[name] = sprite;
+    return sprite;
+}
+
+std::shared_ptr<Texture> SpriteManager::loadTexture(const std::filesystem::path& filepath) {
     int w, h, n;
     unsigned char* data = stbi_load(filepath.string().c_str(), &w, &h, &n, 4);
     if (!data) return nullptr;
@@ -25,10 +104,7 @@ std::shared_ptr<Sprite> SpriteManager::load(const std::string& name, const std::
     stbi_image_free(data);
     if (image == 0) return nullptr;
 
-    Texture texture(image, filepath.string(), Size(static_cast<float>(w), static_cast<float>(h)));
-    auto sprite = std::make_shared<Sprite>(std::make_shared<Texture>(texture), Size(static_cast<float>(width), static_cast<float>(height)));
-    m_sprites[name] = sprite;
-    return sprite;
+    return std::make_shared<Texture>(image, filepath.string(), Size(static_cast<float>(w), static_cast<float>(h)));
 }
 
 std::shared_ptr<Sprite> SpriteManager::get(const std::string& name) {
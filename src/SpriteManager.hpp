@@ -9,6 +9,7 @@
 class SpriteManager {
     public:
         static std::shared_ptr<Sprite> load(const std::string& name, const std::filesystem::path& filepath, int width, int height);
+        static std::shared_ptr<Sprite> loadSheet(const std::string& name, const std::filesystem::path& jsonPath);
         static std::shared_ptr<Sprite> get(const std::string& name);
 
         static void clearGarbage();
@@ -17,4 +18,5 @@ class SpriteManager {
         
     private:
         static std::unordered_map<std::string, std::shared_ptr<Sprite>>& sprites();
+        static std::shared_ptr<Texture> loadTexture(const std::filesystem::path& filepath);
 };
\ No newline at end of file
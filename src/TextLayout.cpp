@@ -0,0 +1,313 @@
+#include "TextLayout.hpp"
+#include "Renderer.hpp"
+#include <algorithm>
+#include <cmath>
+
+static const char* Ellipsis = "\xE2\x80\xA6";
+
+static bool isSpace(char c) {
+    return c == ' ' || c == '\t';
+}
+
+static size_t nextCodepoint(const std::string& text, size_t index) {
+    index++;
+    while (index < text.size() && (static_cast<unsigned char>(text[index]) & 0xC0) == 0x80) {
+        index++;
+    }
+    return index;
+}
+
+void TextLayout::setText(const std::string& text, std::shared_ptr<Font> font, float fontSize, const Color& color) {
+    spans.clear();
+    spans.emplace_back(text, font, fontSize, color);
+    dirty = true;
+}
+
+void TextLayout::setSpans(const std::vector<TextSpan>& spans) {
+    this->spans = spans;
+    dirty = true;
+}
+
+const std::vector<TextSpan>& TextLayout::getSpans() const {
+    return spans;
+}
+
+void TextLayout::setAlignment(Alignment alignment) {
+    this->alignment = alignment;
+}
+
+TextLayout::Alignment TextLayout::getAlignment() const {
+    return alignment;
+}
+
+void TextLayout::setWrap(bool wrap) {
+    this->wrap = wrap;
+    dirty = true;
+}
+
+bool TextLayout::isWrap() const {
+    return wrap;
+}
+
+void TextLayout::setMaxLines(int maxLines) {
+    this->maxLines = maxLines;
+    dirty = true;
+}
+
+int TextLayout::getMaxLines() const {
+    return maxLines;
+}
+
+void TextLayout::setEllipsis(bool ellipsis) {
+    this->ellipsis = ellipsis;
+    dirty = true;
+}
+
+bool TextLayout::isEllipsis() const {
+    return ellipsis;
+}
+
+void TextLayout::invalidate() {
+    dirty = true;
+}
+
+Size TextLayout::measure(float maxWidth) {
+    layout(maxWidth);
+    return layoutSize;
+}
+
+int TextLayout::getLineCount(float maxWidth) {
+    layout(maxWidth);
+    return static_cast<int>(lines.size());
+}
+
+void TextLayout::draw(Point point, float width) {
+    draw(point, width, width);
+}
+
+void TextLayout::draw(Point point, float width, float wrapWidth) {
+    layout(wrapWidth);
+
+    float areaWidth = std::isfinite(width) && width > 0 ? width : layoutSize.width;
+
+    for (const auto& line : lines) {
+        float offset = 0.0f;
+        if (alignment == Alignment::Center) {
+            offset = (areaWidth - line.width) / 2.0f;
+        } else if (alignment == Alignment::Right) {
+            offset = areaWidth - line.width;
+        }
+
+        for (const auto& run : line.runs) {
+            const TextSpan& span = spans[run.span];
+            Renderer::drawAlignedText(run.text, Point(point.x + offset + run.x, point.y + line.y + line.ascender),
+                span.font, span.color, span.fontSize, NVG_ALIGN_LEFT | NVG_ALIGN_BASELINE);
+        }
+    }
+}
+
+void TextLayout::layout(float maxWidth) {
+    if (!std::isfinite(maxWidth) || maxWidth <= 0) {
+        maxWidth = INFINITY;
+    }
+
+    if (!dirty && maxWidth == layoutWidth) return;
+
+    lines.clear();
+    Line line;
+    bool wrapped = false;
+
+    for (int i = 0; i < static_cast<int>(spans.size()); i++) {
+        const TextSpan& span = spans[i];
+        if (!span.font) continue;
+
+        appendMetrics(line, i);
+
+        size_t index = 0;
+        while (index < span.text.size()) {
+            char c = span.text[index];
+
+            if (c == '\n') {
+                trimTrailingSpaces(line);
+                lines.push_back(line);
+                line = Line();
+                appendMetrics(line, i);
+                wrapped = false;
+                index++;
+                continue;
+            }
+
+            size_t end = index;
+            bool space = isSpace(c);
+            while (end < span.text.size() && span.text[end] != '\n' && isSpace(span.text[end]) == space) {
+                end++;
+            }
+
+            std::string token = span.text.substr(index, end - index);
+            index = end;
+
+            if (space) {
+                if (wrapped && line.runs.empty()) continue;
+                appendText(line, i, token, Renderer::getTextAdvance(token, span.font, span.fontSize));
+                continue;
+            }
+
+            float width = Renderer::getTextAdvance(token, span.font, span.fontSize);
+
+            if (wrap && line.width + width > maxWidth && !line.runs.empty()) {
+                trimTrailingSpaces(line);
+                lines.push_back(line);
+                line = Line();
+                appendMetrics(line, i);
+                wrapped = true;
+            }
+
+            if (wrap && width > maxWidth) {
+                breakWord(lines, line, i, token, maxWidth);
+                wrapped = true;
+                continue;
+            }
+
+            appendText(line, i, token, width);
+        }
+    }
+
+    if (!line.runs.empty() || line.height > 0 || lines.empty()) {
+        trimTrailingSpaces(line);
+        lines.push_back(line);
+    }
+
+    bool truncated = false;
+    if (maxLines > 0 && static_cast<int>(lines.size()) > maxLines) {
+        lines.resize(maxLines);
+        truncated = true;
+    }
+
+    if (ellipsis) {
+        for (size_t i = 0; i < lines.size(); i++) {
+            bool last = i + 1 == lines.size();
+            if ((truncated && last) || lines[i].width > maxWidth) {
+                applyEllipsis(lines[i], maxWidth);
+            }
+        }
+    }
+
+    float y = 0.0f;
+    float width = 0.0f;
+    for (auto& current : lines) {
+        current.y = y;
+        y += current.height;
+        width = std::max(width, current.width);
+    }
+
+    layoutSize = Size(width, y);
+    layoutWidth = maxWidth;
+    dirty = false;
+}
+
+void TextLayout::appendText(Line& line, int span, const std::string& text, float width) {
+    if (!line.runs.empty() && line.runs.back().span == span) {
+        line.runs.back().text += text;
+        line.runs.back().width += width;
+    } else {
+        line.runs.push_back({ span, text, line.width, width });
+    }
+
+    line.width += width;
+    appendMetrics(line, span);
+}
+
+void TextLayout::appendMetrics(Line& line, int span) {
+    float ascender, descender, lineHeight;
+    Renderer::getTextMetrics(spans[span].font, spans[span].fontSize, ascender, descender, lineHeight);
+
+    line.ascender = std::max(line.ascender, ascender);
+    line.height = std::max(line.height, lineHeight);
+}
+
+void TextLayout::breakWord(std::vector<Line>& result, Line& line, int span, const std::string& word, float maxWidth) {
+    const TextSpan& textSpan = spans[span];
+    size_t start = 0;
+
+    while (start < word.size()) {
+        size_t end = nextCodepoint(word, start);
+        float width = Renderer::getTextAdvance(word.substr(start, end - start), textSpan.font, textSpan.fontSize);
+
+        while (end < word.size()) {
+            size_t next = nextCodepoint(word, end);
+            float nextWidth = Renderer::getTextAdvance(word.substr(start, next - start), textSpan.font, textSpan.fontSize);
+            if (line.width + nextWidth > maxWidth) break;
+            end = next;
+            width = nextWidth;
+        }
+
+        appendText(line, span, word.substr(start, end - start), width);
+        start = end;
+
+        if (start < word.size()) {
+            result.push_back(line);
+            line = Line();
+            appendMetrics(line, span);
+        }
+    }
+}
+
+void TextLayout::trimTrailingSpaces(Line& line) {
+    while (!line.runs.empty()) {
+        Run& run = line.runs.back();
+        size_t end = run.text.size();
+        while (end > 0 && isSpace(run.text[end - 1])) {
+            end--;
+        }
+
+        if (end == run.text.size()) break;
+
+        run.text.resize(end);
+        if (run.text.empty()) {
+            line.runs.pop_back();
+            continue;
+        }
+
+        const TextSpan& span = spans[run.span];
+        run.width = Renderer::getTextAdvance(run.text, span.font, span.fontSize);
+        break;
+    }
+
+    line.width = line.runs.empty() ? 0.0f : line.runs.back().x + line.runs.back().width;
+}
+
+void TextLayout::applyEllipsis(Line& line, float maxWidth) {
+    int span = line.runs.empty() ? 0 : line.runs.back().span;
+    if (span >= static_cast<int>(spans.size()) || !spans[span].font) return;
+
+    float ellipsisWidth = Renderer::getTextAdvance(Ellipsis, spans[span].font, spans[span].fontSize);
+
+    while (!line.runs.empty() && line.width + ellipsisWidth > maxWidth) {
+        popCodepoint(line);
+    }
+    trimTrailingSpaces(line);
+
+    if (!line.runs.empty()) {
+        span = line.runs.back().span;
+    }
+    appendText(line, span, Ellipsis, ellipsisWidth);
+}
+
+void TextLayout::popCodepoint(Line& line) {
+    Run& run = line.runs.back();
+
+    size_t end = run.text.size() - 1;
+    while (end > 0 && (static_cast<unsigned char>(run.text[end]) & 0xC0) == 0x80) {
+        end--;
+    }
+    run.text.resize(end);
+
+    if (run.text.empty()) {
+        line.runs.pop_back();
+    } else {
+        const TextSpan& span = spans[run.span];
+        run.width = Renderer::getTextAdvance(run.text, span.font, span.fontSize);
+    }
+
+    line.width = line.runs.empty() ? 0.0f : line.runs.back().x + line.runs.back().width;
+}
\ No newline at end of file
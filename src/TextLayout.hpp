@@ -0,0 +1,87 @@
+﻿#pragma once
+
+#include "Font.hpp"
+#include "api/Color.hpp"
+#include "api/Point.hpp"
+#include "api/Size.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+class TextSpan {
+    public:
+        std::string text;
+        std::shared_ptr<Font> font;
+        float fontSize = 0.0f;
+        Color color;
+
+        TextSpan() = default;
+        TextSpan(const std::string& text, std::shared_ptr<Font> font, float fontSize, const Color& color)
+            : text(text), font(font), fontSize(fontSize), color(color) {}
+};
+
+class TextLayout {
+    public:
+        enum class Alignment {
+            Left,
+            Center,
+            Right
+        };
+
+        TextLayout() = default;
+
+        void setText(const std::string& text, std::shared_ptr<Font> font, float fontSize, const Color& color);
+        void setSpans(const std::vector<TextSpan>& spans);
+        const std::vector<TextSpan>& getSpans() const;
+
+        void setAlignment(Alignment alignment);
+        Alignment getAlignment() const;
+        void setWrap(bool wrap);
+        bool isWrap() const;
+        void setMaxLines(int maxLines);
+        int getMaxLines() const;
+        void setEllipsis(bool ellipsis);
+        bool isEllipsis() const;
+
+        void invalidate();
+
+        Size measure(float maxWidth);
+        void draw(Point point, float width);
+        void draw(Point point, float width, float wrapWidth);
+        int getLineCount(float maxWidth);
+
+    private:
+        struct Run {
+            int span;
+            std::string text;
+            float x;
+            float width;
+        };
+
+        struct Line {
+            std::vector<Run> runs;
+            float width = 0.0f;
+            float ascender = 0.0f;
+            float height = 0.0f;
+            float y = 0.0f;
+        };
+
+        std::vector<TextSpan> spans;
+        Alignment alignment = Alignment::Left;
+        bool wrap = true;
+        int maxLines = 0;
+        bool ellipsis = true;
+
+        std::vector<Line> lines;
+        Size layoutSize = Size(0.0f, 0.0f);
+        float layoutWidth = 0.0f;
+        bool dirty = true;
+
+        void layout(float maxWidth);
+        void appendText(Line& line, int span, const std::string& text, float width);
+        void appendMetrics(Line& line, int span);
+        void breakWord(std::vector<Line>& result, Line& line, int span, const std::string& word, float maxWidth);
+        void trimTrailingSpaces(Line& line);
+        void applyEllipsis(Line& line, float maxWidth);
+        void popCodepoint(Line& line);
+};
\ No newline at end of file
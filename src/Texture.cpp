@@ -1,18 +1,34 @@
 #include "Texture.hpp"
+#include "Logger.hpp"
 
 const unsigned char* Texture::getPixelData() const {
-    return pixels.empty() ? nullptr : pixels.data();
+    return pixels.get();
+}
+
+void Texture::releasePixelData() {
+    pixels = nullptr;
+    pixelSize = 0;
+}
+
+bool Texture::requirePixelData() const {
+    if (pixels) return true;
+
+    if (!missingPixelsReported) {
+        missingPixelsReported = true;
+        Logger::warn("Texture", "No pixel data for " + path.string() + ", load it with TextureManager::PixelRetention::Retain to read pixels or build pixel-perfect shapes");
+    }
+    return false;
 }
 
 Color Texture::getPixelColor(int x, int y) const {
     
-    if (x < 0 || x >= getWidth() || y < 0 || y >= getHeight() || pixels.empty()) {
+    if (!requirePixelData() || x < 0 || x >= getWidth() || y < 0 || y >= getHeight()) {
         return Color(0, 0, 0, 0);
     }
     
     int index = (y * getWidth() + x) * 4;
 
-    if (index + 3 >= static_cast<int>(pixels.size())) {
+    if (static_cast<size_t>(index) + 3 >= pixelSize) {
         return Color(0, 0, 0, 0);
     }
     
@@ -3,14 +3,19 @@
 #include "api/Color.hpp"
 #include "api/Size.hpp"
 #include <filesystem>
+#include <functional>
+#include <memory>
 #include <vector>
 
 class Texture {
     
     public:
+        using PixelDeleter = std::function<void(unsigned char*)>;
+
         int handle = -1;
         std::filesystem::path path;
         Size size = Size(0.0f, 0.0f);
+        bool mipmaps = false;
         
         Texture() = default;
         
@@ -20,17 +25,34 @@ class Texture {
         Texture(int handle, std::filesystem::path path, Size size, const unsigned char* pixelData, int dataSize)
          : handle(handle), path(path), size(size) {
             if (pixelData && dataSize > 0) {
-                pixels.resize(dataSize);
-                std::copy(pixelData, pixelData + dataSize, pixels.begin());
+                pixels = std::shared_ptr<unsigned char[]>(new unsigned char[dataSize]);
+                std::copy(pixelData, pixelData + dataSize, pixels.get());
+                pixelSize = static_cast<size_t>(dataSize);
+            }
+        }
+
+        Texture(int handle, std::filesystem::path path, Size size, unsigned char* pixelData, int dataSize, PixelDeleter deleter)
+         : handle(handle), path(path), size(size) {
+            if (pixelData && dataSize > 0) {
+                pixels = std::shared_ptr<unsigned char[]>(pixelData, std::move(deleter));
+                pixelSize = static_cast<size_t>(dataSize);
+            } else if (pixelData && deleter) {
+                deleter(pixelData);
             }
         }
         
         const unsigned char* getPixelData() const;
         Color getPixelColor(int x, int y) const;
+        bool hasPixelData() const { return pixels != nullptr; }
+        // like hasPixelData, but logs once per texture when the pixels were not retained
+        bool requirePixelData() const;
+        void releasePixelData();
         
         int getWidth() const { return static_cast<int>(size.width); }
         int getHeight() const { return static_cast<int>(size.height); }
         
     private:
-        std::vector<unsigned char> pixels;
+        std::shared_ptr<unsigned char[]> pixels;
+        size_t pixelSize = 0;
+        mutable bool missingPixelsReported = false;
 };
\ No newline at end of file
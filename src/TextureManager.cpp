@@ -1,19 +1,42 @@
 ﻿#include "TextureManager.hpp"
 #include "Renderer.hpp"
+#include "nanovg_bgfx.h"
 #include "stb_image.h"
+#include <bimg/decode.h>
+#include <bx/allocator.h>
+#include <algorithm>
+#include <cctype>
+#include <fstream>
 #include <memory>
+#include <vector>
+
+static bx::AllocatorI* imageAllocator() {
+    static bx::DefaultAllocator allocator;
+    return &allocator;
+}
+
+static void releaseImage(void* data, void* userData) {
+    (void)data;
+    bimg::imageFree(static_cast<bimg::ImageContainer*>(userData));
+}
 
 std::unordered_map<std::string, std::shared_ptr<Texture>>& TextureManager::textures() {
     static std::unordered_map<std::string, std::shared_ptr<Texture>> m_textures;
     return m_textures;
 }
 
-std::shared_ptr<Texture> TextureManager::load(std::string name, std::filesystem::path path) {
+std::shared_ptr<Texture> TextureManager::load(std::string name, std::filesystem::path path, Mipmaps mipmaps, PixelRetention pixels) {
 
     auto& m_textures = textures();
     auto it = m_textures.find(name);
     if (it != m_textures.end()) return it->second;
 
+    if (isCompressedContainer(path)) {
+        auto tex = loadCompressed(path);
+        if (tex) m_textures[name] = tex;
+        return tex;
+    }
+
     int w, h, n;
     unsigned char* data = stbi_load(path.string().c_str(), &w, &h, &n, 4);
     
@@ -21,19 +44,75 @@ std::shared_ptr<Texture> TextureManager::load(std::string name, std::filesystem:
         return nullptr;
     }
 
-    int image = nvgCreateImageRGBA(Renderer::context, w, h, 0, data);
+    bool generateMipmaps = mipmaps == Mipmaps::Enabled
+        || (mipmaps == Mipmaps::Auto && mipmapThreshold > 0 && std::max(w, h) >= mipmapThreshold);
+
+    int image = nvgCreateImageRGBA(Renderer::context, w, h, generateMipmaps ? NVG_IMAGE_GENERATE_MIPMAPS : 0, data);
     
     if (image == 0) {
         stbi_image_free(data);
         return nullptr;
     }
 
-    auto tex = std::make_shared<Texture>(image, path.string(), Size(static_cast<float>(w), static_cast<float>(h)), data, w * h * 4);
-    stbi_image_free(data);
+    bool retain = pixels == PixelRetention::Retain || (pixels == PixelRetention::Default && retainPixels);
+    Size size(static_cast<float>(w), static_cast<float>(h));
+    std::shared_ptr<Texture> tex;
+
+    if (retain) {
+        tex = std::make_shared<Texture>(image, path.string(), size, data, w * h * 4, [](unsigned char* pixels) { stbi_image_free(pixels); });
+    } else {
+        tex = std::make_shared<Texture>(image, path.string(), size);
+        stbi_image_free(data);
+    }
+
+    tex->mipmaps = generateMipmaps;
     m_textures[name] = tex;
     return tex;
 }
 
+bool TextureManager::isCompressedContainer(const std::filesystem::path& path) {
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".ktx" || extension == ".ktx2" || extension == ".dds" || extension == ".pvr";
+}
+
+std::shared_ptr<Texture> TextureManager::loadCompressed(const std::filesystem::path& path) {
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return nullptr;
+    }
+
+    std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    bimg::ImageContainer* image = bimg::imageParse(imageAllocator(), data.data(), static_cast<uint32_t>(data.size()));
+
+    if (!image) {
+        return nullptr;
+    }
+
+    bgfx::TextureFormat::Enum format = bgfx::TextureFormat::Enum(image->m_format);
+    uint64_t flags = BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP;
+
+    if (image->m_cubeMap || image->m_depth > 1 || !bgfx::isTextureValid(0, false, image->m_numLayers, format, flags)) {
+        bimg::imageFree(image);
+        return nullptr;
+    }
+
+    uint16_t width = uint16_t(image->m_width);
+    uint16_t height = uint16_t(image->m_height);
+    const bgfx::Memory* memory = bgfx::makeRef(image->m_data, image->m_size, releaseImage, image);
+    bgfx::TextureHandle handle = bgfx::createTexture2D(width, height, 1 < image->m_numMips, image->m_numLayers, format, flags, memory);
+
+    if (!bgfx::isValid(handle)) {
+        return nullptr;
+    }
+
+    int texture = nvgCreateBgfxTexture(Renderer::context, handle, width, height, 0);
+    auto tex = std::make_shared<Texture>(texture, path, Size(static_cast<float>(width), static_cast<float>(height)));
+    tex->mipmaps = 1 < image->m_numMips;
+    return tex;
+}
+
 std::shared_ptr<Texture> TextureManager::get(std::string name) {
     auto& m_textures = textures();
     auto it = m_textures.find(name);
@@ -71,4 +150,20 @@ void TextureManager::unloadAll() {
     }
     
     m_textures.clear();
+}
+
+void TextureManager::setMipmapThreshold(int size) {
+    mipmapThreshold = size;
+}
+
+int TextureManager::getMipmapThreshold() {
+    return mipmapThreshold;
+}
+
+void TextureManager::setRetainPixels(bool retain) {
+    retainPixels = retain;
+}
+
+bool TextureManager::getRetainPixels() {
+    return retainPixels;
 }
\ No newline at end of file
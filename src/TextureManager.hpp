@@ -1,4 +1,6 @@
-﻿#include "Texture.hpp"
+﻿#pragma once
+
+#include "Texture.hpp"
 #include <filesystem>
 #include <memory>
 #include <string>
@@ -7,12 +9,37 @@
 class TextureManager {
 
     public:
-        static std::shared_ptr<Texture> load(std::string name, std::filesystem::path path);
+        enum class Mipmaps {
+            Auto,
+            Enabled,
+            Disabled
+        };
+
+        enum class PixelRetention {
+            Default,
+            Retain,
+            Discard
+        };
+
+        static const int DefaultMipmapThreshold = 1024;
+
+        static std::shared_ptr<Texture> load(std::string name, std::filesystem::path path, Mipmaps mipmaps = Mipmaps::Auto,
+            PixelRetention pixels = PixelRetention::Default);
         static std::shared_ptr<Texture> get(std::string name);
         static void unload(std::string name);
         static void unloadAll();
         void clearGarbage();
 
+        static void setMipmapThreshold(int size);
+        static int getMipmapThreshold();
+        static void setRetainPixels(bool retain);
+        static bool getRetainPixels();
+
     private:
+        static inline int mipmapThreshold = DefaultMipmapThreshold;
+        static inline bool retainPixels = false;
+
         static std::unordered_map<std::string, std::shared_ptr<Texture>>& textures();
+        static bool isCompressedContainer(const std::filesystem::path& path);
+        static std::shared_ptr<Texture> loadCompressed(const std::filesystem::path& path);
 };
\ No newline at end of file
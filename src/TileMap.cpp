@@ -0,0 +1,276 @@
+#include "TileMap.hpp"
+#include "Renderer.hpp"
+#include "api/Color.hpp"
+#include "api/Object.hpp"
+#include "api/World.hpp"
+#include <algorithm>
+#include <cmath>
+
+TileMap::TileMap(std::shared_ptr<Sprite> sprite, int columns, int rows, Size tileSize)
+    : sprite(sprite), tileSize(tileSize), columns(std::max(columns, 0)), rows(std::max(rows, 0)) {
+
+    if ((this->tileSize.width <= 0.0f || this->tileSize.height <= 0.0f) && sprite) {
+        this->tileSize = sprite->size;
+    }
+
+    chunkColumns = (this->columns + ChunkSize - 1) / ChunkSize;
+    chunkRows = (this->rows + ChunkSize - 1) / ChunkSize;
+
+    tiles.assign(static_cast<size_t>(this->columns) * this->rows, EmptyTile);
+    chunks.resize(static_cast<size_t>(chunkColumns) * chunkRows);
+}
+
+TileMap::~TileMap() {
+    for (auto& chunk : chunks) {
+        Renderer::deleteTriangleBuffer(chunk.buffer);
+    }
+}
+
+void TileMap::setTile(int column, int row, int tile) {
+    if (column < 0 || row < 0 || column >= columns || row >= rows) {
+        return;
+    }
+
+    int& current = tiles[static_cast<size_t>(row) * columns + column];
+
+    if (current == tile) {
+        return;
+    }
+
+    current = tile;
+    getChunk(column / ChunkSize, row / ChunkSize).dirty = true;
+}
+
+int TileMap::getTile(int column, int row) const {
+    if (column < 0 || row < 0 || column >= columns || row >= rows) {
+        return EmptyTile;
+    }
+
+    return tiles[static_cast<size_t>(row) * columns + column];
+}
+
+void TileMap::setTiles(const std::vector<int>& tiles) {
+    size_t count = std::min(tiles.size(), this->tiles.size());
+    std::copy(tiles.begin(), tiles.begin() + count, this->tiles.begin());
+    markAllDirty();
+}
+
+void TileMap::fill(int tile) {
+    std::fill(tiles.begin(), tiles.end(), tile);
+    markAllDirty();
+}
+
+void TileMap::setSprite(std::shared_ptr<Sprite> sprite) {
+    this->sprite = sprite;
+    markAllDirty();
+}
+
+std::shared_ptr<Sprite> TileMap::getSprite() const {
+    return sprite;
+}
+
+void TileMap::setPosition(Point position) {
+    this->position = position;
+}
+
+Point TileMap::getPosition() const {
+    return position;
+}
+
+int TileMap::getColumns() const {
+    return columns;
+}
+
+int TileMap::getRows() const {
+    return rows;
+}
+
+Size TileMap::getTileSize() const {
+    return tileSize;
+}
+
+Size TileMap::getSize() const {
+    return Size(columns * tileSize.width, rows * tileSize.height);
+}
+
+Point TileMap::tileToWorld(int column, int row) const {
+    return Point(position.x + column * tileSize.width, position.y + row * tileSize.height);
+}
+
+bool TileMap::worldToTile(Point point, int& column, int& row) const {
+    if (tileSize.width <= 0.0f || tileSize.height <= 0.0f) {
+        return false;
+    }
+
+    column = static_cast<int>(std::floor((point.x - position.x) / tileSize.width));
+    row = static_cast<int>(std::floor((point.y - position.y) / tileSize.height));
+
+    return column >= 0 && row >= 0 && column < columns && row < rows;
+}
+
+TileMap::Chunk& TileMap::getChunk(int column, int row) {
+    return chunks[static_cast<size_t>(row) * chunkColumns + column];
+}
+
+void TileMap::markAllDirty() {
+    for (auto& chunk : chunks) {
+        chunk.dirty = true;
+    }
+}
+
+void TileMap::rebuildChunk(int chunkColumn, int chunkRow) {
+    Chunk& chunk = getChunk(chunkColumn, chunkRow);
+    Renderer::deleteTriangleBuffer(chunk.buffer);
+    chunk.buffer = 0;
+    chunk.dirty = false;
+    vertices.clear();
+
+    Size textureSize = sprite->texture->size;
+
+    if (textureSize.width <= 0.0f || textureSize.height <= 0.0f) {
+        return;
+    }
+
+    int firstColumn = chunkColumn * ChunkSize;
+    int firstRow = chunkRow * ChunkSize;
+    int lastColumn = std::min(firstColumn + ChunkSize, columns);
+    int lastRow = std::min(firstRow + ChunkSize, rows);
+
+    for (int row = firstRow; row < lastRow; ++row) {
+        for (int column = firstColumn; column < lastColumn; ++column) {
+            int tile = tiles[static_cast<size_t>(row) * columns + column];
+
+            if (tile < 0) {
+                continue;
+            }
+
+            Rect source = sprite->getFrame(tile).source;
+            float u0 = source.x / textureSize.width;
+            float v0 = source.y / textureSize.height;
+            float u1 = (source.x + source.width) / textureSize.width;
+            float v1 = (source.y + source.height) / textureSize.height;
+
+            float x0 = column * tileSize.width;
+            float y0 = row * tileSize.height;
+            float x1 = x0 + tileSize.width;
+            float y1 = y0 + tileSize.height;
+
+            vertices.insert(vertices.end(), {
+                x0, y0, u0, v0,
+                x1, y0, u1, v0,
+                x1, y1, u1, v1,
+                x0, y0, u0, v0,
+                x1, y1, u1, v1,
+                x0, y1, u0, v1
+            });
+        }
+    }
+
+    chunk.buffer = Renderer::createTriangleBuffer(vertices.data(), static_cast<int>(vertices.size() / 4));
+}
+
+void TileMap::draw() {
+    Renderer::save();
+    Renderer::translate(position);
+    drawChunks(Renderer::getVisibleRect());
+    Renderer::restore();
+}
+
+void TileMap::draw(Rect visibleArea) {
+    Renderer::save();
+    Renderer::translate(position);
+    drawChunks(Rect(visibleArea.x - position.x, visibleArea.y - position.y, visibleArea.width, visibleArea.height));
+    Renderer::restore();
+}
+
+void TileMap::drawChunks(Rect area) {
+    if (!sprite || !sprite->texture || sprite->texture->handle <= 0 || chunks.empty()) {
+        return;
+    }
+
+    float chunkWidth = ChunkSize * tileSize.width;
+    float chunkHeight = ChunkSize * tileSize.height;
+
+    if (chunkWidth <= 0.0f || chunkHeight <= 0.0f) {
+        return;
+    }
+
+    int firstColumn = std::max(static_cast<int>(std::floor(area.x / chunkWidth)), 0);
+    int firstRow = std::max(static_cast<int>(std::floor(area.y / chunkHeight)), 0);
+    int lastColumn = std::min(static_cast<int>(std::floor((area.x + area.width) / chunkWidth)), chunkColumns - 1);
+    int lastRow = std::min(static_cast<int>(std::floor((area.y + area.height) / chunkHeight)), chunkRows - 1);
+
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            Chunk& chunk = getChunk(column, row);
+
+            if (chunk.dirty) {
+                rebuildChunk(column, row);
+            }
+
+            Renderer::drawTriangleBuffer(chunk.buffer, Color::White, sprite->texture->handle);
+        }
+    }
+}
+
+std::vector<Rect> TileMap::getCollisionRects(SolidFunction isSolid) const {
+    std::vector<Rect> rects;
+    std::vector<bool> merged(tiles.size(), false);
+
+    auto solid = [&](int column, int row) {
+        size_t index = static_cast<size_t>(row) * columns + column;
+        if (merged[index]) return false;
+        int tile = tiles[index];
+        return isSolid ? isSolid(tile) : tile != EmptyTile;
+    };
+
+    for (int row = 0; row < rows; ++row) {
+        for (int column = 0; column < columns; ++column) {
+            if (!solid(column, row)) {
+                continue;
+            }
+
+            int width = 1;
+            while (column + width < columns && solid(column + width, row)) {
+                width++;
+            }
+
+            int height = 1;
+            while (row + height < rows) {
+                bool rowSolid = true;
+                for (int x = column; x < column + width; ++x) {
+                    if (!solid(x, row + height)) {
+                        rowSolid = false;
+                        break;
+                    }
+                }
+
+                if (!rowSolid) {
+                    break;
+                }
+
+                height++;
+            }
+
+            for (int y = row; y < row + height; ++y) {
+                std::fill_n(merged.begin() + static_cast<size_t>(y) * columns + column, width, true);
+            }
+
+            rects.emplace_back(position.x + column * tileSize.width, position.y + row * tileSize.height,
+                width * tileSize.width, height * tileSize.height);
+        }
+    }
+
+    return rects;
+}
+
+std::shared_ptr<Object> TileMap::createCollisionObject(World& world, SolidFunction isSolid) const {
+    std::vector<Rect> rects = getCollisionRects(isSolid);
+    if (rects.empty()) {
+        return nullptr;
+    }
+
+    auto object = world.createCompoundObject(rects, false, false);
+    object->setVisible(false);
+    return object;
+}
\ No newline at end of file
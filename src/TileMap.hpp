@@ -0,0 +1,78 @@
+﻿#pragma once
+
+#include "Sprite.hpp"
+#include "api/Point.hpp"
+#include "api/Rect.hpp"
+#include "api/Size.hpp"
+#include <functional>
+#include <memory>
+#include <vector>
+
+class World;
+class Object;
+
+// Each ChunkSize x ChunkSize chunk is uploaded once into a static GPU buffer and redrawn with one
+// draw call, so nothing is sent per frame however far out the view is zoomed. Editing a tile
+// re-uploads only its chunk. bgfx allows 4096 vertex buffers by default, which is about 4 million
+// tiles of non-empty chunks per process; raise BGFX_CONFIG_MAX_VERTEX_BUFFERS for larger maps.
+class TileMap {
+    public:
+        using SolidFunction = std::function<bool(int tile)>;
+
+        static const int ChunkSize = 32;
+        static const int EmptyTile = -1;
+
+        TileMap(std::shared_ptr<Sprite> sprite, int columns, int rows, Size tileSize = Size(0.0f, 0.0f));
+        ~TileMap();
+
+        TileMap(const TileMap&) = delete;
+        TileMap& operator=(const TileMap&) = delete;
+
+        void setTile(int column, int row, int tile);
+        int getTile(int column, int row) const;
+        void setTiles(const std::vector<int>& tiles);
+        void fill(int tile);
+
+        void setSprite(std::shared_ptr<Sprite> sprite);
+        std::shared_ptr<Sprite> getSprite() const;
+        void setPosition(Point position);
+        Point getPosition() const;
+
+        int getColumns() const;
+        int getRows() const;
+        Size getTileSize() const;
+        Size getSize() const;
+
+        Point tileToWorld(int column, int row) const;
+        bool worldToTile(Point point, int& column, int& row) const;
+
+        void draw();
+        void draw(Rect visibleArea);
+
+        std::vector<Rect> getCollisionRects(SolidFunction isSolid = nullptr) const;
+        // a single static body holding every merged rect, null when nothing is solid
+        std::shared_ptr<Object> createCollisionObject(World& world, SolidFunction isSolid = nullptr) const;
+
+    private:
+        struct Chunk {
+            int buffer = 0;
+            bool dirty = true;
+        };
+
+        std::shared_ptr<Sprite> sprite;
+        Point position;
+        Size tileSize;
+        int columns;
+        int rows;
+        int chunkColumns;
+        int chunkRows;
+
+        std::vector<int> tiles;
+        std::vector<Chunk> chunks;
+        std::vector<float> vertices;
+
+        Chunk& getChunk(int column, int row);
+        void markAllDirty();
+        void rebuildChunk(int chunkColumn, int chunkRow);
+        void drawChunks(Rect area);
+};
\ No newline at end of file
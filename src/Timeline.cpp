@@ -0,0 +1,285 @@
+#include "Timeline.hpp"
+#include "Ease.hpp"
+#include <algorithm>
+#include <cmath>
+
+Timeline::TrackId Timeline::animate(float* target, float from, float to, float duration, Easing easing, float delay) {
+    return createTrack(Target::Float, target, &from, &to, 1, duration, easing, delay);
+}
+
+Timeline::TrackId Timeline::animate(Point* target, Point from, Point to, float duration, Easing easing, float delay) {
+    float start[] = { from.x, from.y };
+    float end[] = { to.x, to.y };
+    return createTrack(Target::Point, target, start, end, 2, duration, easing, delay);
+}
+
+Timeline::TrackId Timeline::animate(Color* target, Color from, Color to, float duration, Easing easing, float delay) {
+    float start[] = { float(from.red), float(from.green), float(from.blue), float(from.alpha) };
+    float end[] = { float(to.red), float(to.green), float(to.blue), float(to.alpha) };
+    return createTrack(Target::Color, target, start, end, 4, duration, easing, delay);
+}
+
+Timeline::TrackId Timeline::animate(std::function<void(float)> callback, float from, float to, float duration, Easing easing, float delay) {
+    TrackId id = createTrack(Target::Callback, nullptr, &from, &to, 1, duration, easing, delay);
+    tracks[id].callback = callback;
+    return id;
+}
+
+void Timeline::setLoop(TrackId id, int count, bool yoyo) {
+    auto it = tracks.find(id);
+    if (it == tracks.end()) return;
+
+    it->second.loops = count;
+    it->second.yoyo = yoyo;
+}
+
+void Timeline::onComplete(TrackId id, std::function<void()> callback) {
+    auto it = tracks.find(id);
+    if (it == tracks.end()) return;
+
+    it->second.onComplete = callback;
+}
+
+void Timeline::then(TrackId first, TrackId next) {
+    auto it = tracks.find(next);
+    if (it == tracks.end() || first == next) return;
+
+    Track& track = it->second;
+    stopTrack(track);
+
+    if (tracks.find(first) != tracks.end()) {
+        track.after = first;
+    } else {
+        startTrack(next, track);
+    }
+}
+
+void Timeline::cancel(TrackId id) {
+    auto it = tracks.find(id);
+    if (it == tracks.end()) return;
+
+    stopTrack(it->second);
+    tracks.erase(it);
+
+    for (auto& [otherId, other] : tracks) {
+        if (other.after == id) {
+            other.after = InvalidTrack;
+            startTrack(otherId, other);
+        }
+    }
+}
+
+bool Timeline::isActive(TrackId id) {
+    return tracks.find(id) != tracks.end();
+}
+
+void Timeline::update(float deltaTime) {
+    for (size_t i = 0; i < groups.size(); i++) {
+        if (!groups[i].owner.empty()) {
+            evaluate(static_cast<Easing>(i), groups[i], deltaTime);
+        }
+    }
+
+    std::vector<TrackId> completed;
+    std::vector<std::pair<TrackId, float>> callbacks;
+
+    for (auto& [id, track] : tracks) {
+        if (!track.running) continue;
+
+        if (track.target == Target::Callback) {
+            callbacks.emplace_back(id, groups[static_cast<size_t>(track.easing)].value[track.channel]);
+        } else {
+            apply(track);
+        }
+
+        Group& group = groups[static_cast<size_t>(track.easing)];
+        if (group.time[track.channel] < track.duration) continue;
+
+        if (track.loops != 0) {
+            for (int c = 0; c < track.channels; c++) {
+                int index = track.channel + c;
+                group.time[index] = track.duration > 0 ? std::fmod(group.time[index], track.duration) : 0.0f;
+                if (track.yoyo) {
+                    group.start[index] += group.change[index];
+                    group.change[index] = -group.change[index];
+                }
+            }
+            if (track.loops > 0) {
+                track.loops--;
+            }
+        } else {
+            stopTrack(track);
+            completed.push_back(id);
+        }
+    }
+
+    for (auto& [id, value] : callbacks) {
+        auto it = tracks.find(id);
+        if (it == tracks.end() || !it->second.callback) continue;
+
+        auto callback = it->second.callback;
+        callback(value);
+    }
+
+    for (TrackId id : completed) {
+        auto it = tracks.find(id);
+        if (it == tracks.end()) continue;
+
+        auto callback = it->second.onComplete;
+        tracks.erase(it);
+
+        for (auto& [otherId, other] : tracks) {
+            if (other.after == id) {
+                other.after = InvalidTrack;
+                startTrack(otherId, other);
+            }
+        }
+
+        if (callback) {
+            callback();
+        }
+    }
+
+    if (compactionNeeded) {
+        compact();
+    }
+}
+
+void Timeline::clear() {
+    tracks.clear();
+    groups.clear();
+    compactionNeeded = false;
+}
+
+size_t Timeline::getTrackCount() {
+    return tracks.size();
+}
+
+Timeline::TrackId Timeline::createTrack(Target target, void* pointer, const float* from, const float* to, int channels,
+    float duration, Easing easing, float delay) {
+    TrackId id = nextTrackId++;
+
+    Track& track = tracks[id];
+    track.target = target;
+    track.pointer = pointer;
+    track.easing = easing;
+    track.channels = channels;
+    track.duration = std::max(duration, 0.0f);
+    track.delay = std::max(delay, 0.0f);
+    std::copy(from, from + channels, track.from);
+    std::copy(to, to + channels, track.to);
+
+    startTrack(id, track);
+    return id;
+}
+
+void Timeline::startTrack(TrackId id, Track& track) {
+    size_t index = static_cast<size_t>(track.easing);
+    if (groups.size() <= index) {
+        groups.resize(index + 1);
+    }
+
+    Group& group = groups[index];
+    track.channel = static_cast<int>(group.owner.size());
+    track.running = true;
+
+    for (int c = 0; c < track.channels; c++) {
+        group.start.push_back(track.from[c]);
+        group.change.push_back(track.to[c] - track.from[c]);
+        group.time.push_back(-track.delay);
+        group.duration.push_back(track.duration);
+        group.value.push_back(track.from[c]);
+        group.owner.push_back(id);
+    }
+}
+
+void Timeline::stopTrack(Track& track) {
+    if (!track.running) return;
+
+    Group& group = groups[static_cast<size_t>(track.easing)];
+    for (int c = 0; c < track.channels; c++) {
+        group.owner[track.channel + c] = InvalidTrack;
+    }
+
+    track.running = false;
+    track.channel = -1;
+    compactionNeeded = true;
+}
+
+void Timeline::evaluate(Easing easing, Group& group, float deltaTime) {
+    size_t count = group.owner.size();
+    float* start = group.start.data();
+    float* change = group.change.data();
+    float* time = group.time.data();
+    const float* duration = group.duration.data();
+    float* value = group.value.data();
+
+    for (size_t i = 0; i < count; i++) {
+        time[i] += deltaTime;
+        value[i] = duration[i] > 0 ? std::clamp(time[i] / duration[i], 0.0f, 1.0f) : 1.0f;
+    }
+
+    Easings::evaluate(easing, value, value, count, true);
+
+    for (size_t i = 0; i < count; i++) {
+        value[i] = start[i] + change[i] * value[i];
+    }
+}
+
+void Timeline::apply(Track& track) {
+    const float* value = groups[static_cast<size_t>(track.easing)].value.data() + track.channel;
+
+    switch (track.target) {
+        case Target::Float:
+            *static_cast<float*>(track.pointer) = value[0];
+            break;
+        case Target::Point: {
+            Point* point = static_cast<Point*>(track.pointer);
+            point->x = value[0];
+            point->y = value[1];
+            break;
+        }
+        case Target::Color: {
+            Color* color = static_cast<Color*>(track.pointer);
+            color->red = static_cast<int>(std::lround(value[0]));
+            color->green = static_cast<int>(std::lround(value[1]));
+            color->blue = static_cast<int>(std::lround(value[2]));
+            color->alpha = static_cast<int>(std::lround(value[3]));
+            break;
+        }
+        case Target::Callback:
+            break;
+    }
+}
+
+void Timeline::compact() {
+    for (auto& group : groups) {
+        size_t write = 0;
+        for (size_t read = 0; read < group.owner.size(); read++) {
+            TrackId owner = group.owner[read];
+            if (owner == InvalidTrack) continue;
+
+            auto it = tracks.find(owner);
+            if (it != tracks.end() && it->second.channel == static_cast<int>(read)) {
+                it->second.channel = static_cast<int>(write);
+            }
+
+            group.start[write] = group.start[read];
+            group.change[write] = group.change[read];
+            group.time[write] = group.time[read];
+            group.duration[write] = group.duration[read];
+            group.value[write] = group.value[read];
+            group.owner[write] = owner;
+            write++;
+        }
+
+        group.start.resize(write);
+        group.change.resize(write);
+        group.time.resize(write);
+        group.duration.resize(write);
+        group.value.resize(write);
+        group.owner.resize(write);
+    }
+
+    compactionNeeded = false;
+}
\ No newline at end of file
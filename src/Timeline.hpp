@@ -0,0 +1,79 @@
+﻿#pragma once
+
+#include "Animation.hpp"
+#include "api/Point.hpp"
+#include "api/Color.hpp"
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+class Timeline {
+    public:
+        using TrackId = unsigned int;
+        static const TrackId InvalidTrack = 0;
+
+        static TrackId animate(float* target, float from, float to, float duration, Easing easing, float delay = 0.0f);
+        static TrackId animate(Point* target, Point from, Point to, float duration, Easing easing, float delay = 0.0f);
+        static TrackId animate(Color* target, Color from, Color to, float duration, Easing easing, float delay = 0.0f);
+        static TrackId animate(std::function<void(float)> callback, float from, float to, float duration, Easing easing, float delay = 0.0f);
+
+        static void setLoop(TrackId id, int count = -1, bool yoyo = false);
+        static void onComplete(TrackId id, std::function<void()> callback);
+        static void then(TrackId first, TrackId next);
+        static void cancel(TrackId id);
+        static bool isActive(TrackId id);
+
+        static void update(float deltaTime);
+        static void clear();
+        static size_t getTrackCount();
+
+    private:
+        enum class Target {
+            Float,
+            Point,
+            Color,
+            Callback
+        };
+
+        static const int MaxChannels = 4;
+
+        struct Track {
+            Target target;
+            void* pointer = nullptr;
+            std::function<void(float)> callback;
+            std::function<void()> onComplete;
+            Easing easing;
+            float from[MaxChannels];
+            float to[MaxChannels];
+            int channels;
+            int channel = -1;
+            float duration;
+            float delay;
+            int loops = 0;
+            bool yoyo = false;
+            TrackId after = InvalidTrack;
+            bool running = false;
+        };
+
+        struct Group {
+            std::vector<float> start;
+            std::vector<float> change;
+            std::vector<float> time;
+            std::vector<float> duration;
+            std::vector<float> value;
+            std::vector<TrackId> owner;
+        };
+
+        static inline std::unordered_map<TrackId, Track> tracks;
+        static inline std::vector<Group> groups;
+        static inline TrackId nextTrackId = 1;
+        static inline bool compactionNeeded = false;
+
+        static TrackId createTrack(Target target, void* pointer, const float* from, const float* to, int channels,
+            float duration, Easing easing, float delay);
+        static void startTrack(TrackId id, Track& track);
+        static void stopTrack(Track& track);
+        static void evaluate(Easing easing, Group& group, float deltaTime);
+        static void apply(Track& track);
+        static void compact();
+};
\ No newline at end of file
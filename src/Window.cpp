@@ -1,5 +1,6 @@
 ﻿#include "Window.hpp"
 #include "Renderer.hpp"
+#include "Layer.hpp"
 #include "SDL3/SDL_events.h"
 #include "SDL3/SDL_hints.h"
 #include "SDL3/SDL_video.h"
@@ -16,9 +17,14 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <algorithm>
 #include "Renderer.hpp"
 #include "TextureManager.hpp"
 #include "Camera.hpp"
+#include "Timeline.hpp"
+#include "AnimationSystem.hpp"
+#include "AnimationClipManager.hpp"
+#include "JobSystem.hpp"
 #include "Logger.hpp"
 #include "Platform.hpp"
 
@@ -37,6 +43,8 @@ int Window::frameCount = 0;
 float Window::accumulatedFps = 0.0f;
 std::vector<std::unique_ptr<Scene>> Window::sceneStack;
 Size Window::actualWindowSize;
+std::shared_ptr<Layer> Window::snapshotLayer;
+bool Window::snapshotValid = false;
 
 void Window::create(const Config& cfg) {
     config = cfg;
@@ -254,6 +262,8 @@ void Window::show() {
                 }
 		}
 
+        Timeline::update(getDeltaTime());
+        AnimationSystem::updateAll(getDeltaTime());
         handleUpdate();
 
         uint16_t viewWidth = config.fixedCoordinateMode ? uint16_t(config.virtualSize.width) : uint16_t(config.size.width);
@@ -263,7 +273,7 @@ void Window::show() {
 
         handleRender();
 
-        bgfx::frame();        
+        Renderer::frame();        
         
         if (config.targetFps > 0 && !config.vsync) {
             double targetFrameTime = 1.0 / config.targetFps;
@@ -284,7 +294,12 @@ void Window::shutdown() {
         sceneStack.pop_back();
     }
     
+    Timeline::clear();
+    AnimationClipManager::unloadAll();
     TextureManager::unloadAll();
+    JobSystem::shutdown();
+
+    snapshotLayer = nullptr;
     Renderer::shutdown();
 	bgfx::shutdown();
 	SDL_DestroyWindow(window);
@@ -421,6 +436,13 @@ void Window::setFullscreen(bool enable) {
     SDL_SetWindowFullscreen(window, flags);
 }
 
+float Window::getDevicePixelRatio() {
+    if (!config.fixedCoordinateMode) {
+        return 1.0f;
+    }
+    return actualWindowSize.width / config.virtualSize.width;
+}
+
 float Window::getDeltaTime() {
     return deltaTime * 1000.0f;
 }
@@ -430,6 +452,7 @@ int Window::getFPS() {
 }
 
 void Window::_pushScene(std::unique_ptr<Scene> newScene) {
+    snapshotValid = false;
     if(newScene) {
         sceneStack.push_back(std::move(newScene));
         sceneStack.back()->onInit();
@@ -437,6 +460,7 @@ void Window::_pushScene(std::unique_ptr<Scene> newScene) {
 }
 
 void Window::popScene() {
+    snapshotValid = false;
     if (!sceneStack.empty()) {
         sceneStack.back()->onExit();
         sceneStack.pop_back();
@@ -444,6 +468,7 @@ void Window::popScene() {
 }
 
 void Window::_setScene(std::unique_ptr<Scene> newScene) {
+    snapshotValid = false;
     if (!sceneStack.empty()) {
         sceneStack.back()->onExit();
         sceneStack.pop_back();
@@ -454,6 +479,10 @@ void Window::_setScene(std::unique_ptr<Scene> newScene) {
     }
 }
 
+void Window::invalidateSnapshot() {
+    snapshotValid = false;
+}
+
 std::unique_ptr<Scene> Window::getTopScene() {
     if (!sceneStack.empty()) return std::move(sceneStack.back());
     return nullptr;
@@ -472,32 +501,84 @@ void Window::handleRender() {
 
     float renderWidth = config.fixedCoordinateMode ? config.virtualSize.width : config.size.width;
     float renderHeight = config.fixedCoordinateMode ? config.virtualSize.height : config.size.height;
-    float devicePixelRatio = 1.0f;
+    float devicePixelRatio = getDevicePixelRatio();
+    
+    Size renderSize(renderWidth, renderHeight);
 
-    if (config.fixedCoordinateMode) {
-        devicePixelRatio = actualWindowSize.width / renderWidth;
+    size_t firstVisible = 0;
+    for (size_t i = sceneStack.size(); i-- > 0;) {
+        if (sceneStack[i]->isOpaque()) {
+            firstVisible = i;
+            break;
+        }
     }
-    
-    for (auto& scene : sceneStack) {
 
-        nvgBeginFrame(Renderer::context,
-            renderWidth,
-            renderHeight,
-            devicePixelRatio);
+    bool useSnapshot = sceneStack.size() > 1 && firstVisible < sceneStack.size() - 1 && sceneStack.back()->shouldSnapshotBackground();
+    bool drawSnapshot = useSnapshot && snapshotValid && snapshotLayer && snapshotLayer->valid;
+    size_t firstScene = drawSnapshot ? sceneStack.size() - 1 : firstVisible;
 
-        Renderer::save();
-        Camera& cam = scene->getCamera();
+    bool frameStarted = false;
+    bgfx::ViewId currentViewId = 0;
 
-        Renderer::translate(-cam.point);
-        Renderer::scaleAndRotate(Rect(cam.point, renderWidth, renderHeight), cam.zoom, cam.angle);
-        
-        scene->onRender();
-        Renderer::restore();
+    for (size_t i = firstScene; i < sceneStack.size(); ++i) {
+
+        Scene& scene = *sceneStack[i];
+        bgfx::ViewId viewId = std::min(scene.getViewId(), Renderer::LastSceneViewId);
+
+        if (!frameStarted || viewId != currentViewId) {
+            if (frameStarted) {
+                Renderer::endFrame();
+            }
+
+            Renderer::beginFrame(viewId, renderSize, devicePixelRatio);
+            frameStarted = true;
+            currentViewId = viewId;
+        }
+
+        if (drawSnapshot && i == firstScene) {
+            Renderer::drawRenderTarget(snapshotLayer->getImage(), Rect(0.0f, 0.0f, renderWidth, renderHeight));
+        }
+
+        renderScene(scene, renderSize);
+    }
+
+    if (useSnapshot && !drawSnapshot) {
+        updateSnapshot(firstVisible, sceneStack.size() - 1, renderSize, devicePixelRatio);
+    }
 
-        nvgEndFrame(Renderer::context);
+    if (frameStarted) {
+        Renderer::endFrame();
     }
 }
 
+void Window::renderScene(Scene& scene, Size renderSize) {
+    Renderer::save();
+    Camera& cam = scene.getCamera();
+
+    Renderer::translate(-cam.point);
+    Renderer::scaleAndRotate(Rect(cam.point, renderSize.width, renderSize.height), cam.zoom, cam.angle);
+    
+    scene.onRender();
+    Renderer::restore();
+}
+
+void Window::updateSnapshot(size_t begin, size_t end, Size renderSize, float devicePixelRatio) {
+
+    if (!snapshotLayer || snapshotLayer->size != renderSize || snapshotLayer->devicePixelRatio != devicePixelRatio) {
+        snapshotLayer = std::make_shared<Layer>(renderSize, devicePixelRatio);
+    }
+
+    snapshotLayer->valid = false;
+
+    Renderer::renderLayer(snapshotLayer, [begin, end, renderSize]() {
+        for (size_t i = begin; i < end; ++i) {
+            renderScene(*sceneStack[i], renderSize);
+        }
+    });
+
+    snapshotValid = true;
+}
+
 void Window::handleMousePressed(Point point, int button) {
     if (!sceneStack.empty()) {
         sceneStack.back()->onMousePressed(point, button);
@@ -547,6 +628,7 @@ void Window::handleFocusLost() {
 }
 
 void Window::handleResize(int width, int height) {
+    snapshotValid = false;
     for(auto& scene : sceneStack) {
         scene->onResize(width, height);
     }
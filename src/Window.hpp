@@ -11,6 +11,8 @@
 #include <type_traits>
 #include <utility>
 
+class Layer;
+
 class Window {
 
     public:
@@ -52,6 +54,7 @@ class Window {
         static Size getSize();       
         static int getWidth();
         static int getHeight();
+        static float getDevicePixelRatio();
         
         static void setVsync(bool enable);
         static bool isVsync();
@@ -68,6 +71,7 @@ class Window {
         static int getFPS();
 
         static void popScene();
+        static void invalidateSnapshot();
         static std::unique_ptr<Scene> getTopScene();
 
         template<typename T>
@@ -120,10 +124,15 @@ class Window {
         static std::vector<std::unique_ptr<Scene>> sceneStack;
         static Size actualWindowSize;
 
+        static std::shared_ptr<Layer> snapshotLayer;
+        static bool snapshotValid;
+
         static void _pushScene(std::unique_ptr<Scene> newScene);
         static void _setScene(std::unique_ptr<Scene> newScene);
         static void handleUpdate();
         static void handleRender();
+        static void renderScene(Scene& scene, Size renderSize);
+        static void updateSnapshot(size_t begin, size_t end, Size renderSize, float devicePixelRatio);
         static void handleMousePressed(Point point, int button);
         static void handleMouseReleased(Point point, int button);
         static void handleMouseMoved(Point point);
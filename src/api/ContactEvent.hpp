@@ -0,0 +1,21 @@
+#pragma once
+#include "Point.hpp"
+
+class Object;
+
+struct ContactEvent {
+    enum class Type {
+        Begin,
+        End,
+        Hit,
+        SensorBegin,
+        SensorEnd
+    };
+
+    Type type;
+    Object* object = nullptr;
+    Object* other = nullptr;
+    Point point;
+    Point normal;
+    float approachSpeed = 0.0f;
+};
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "../Sprite.hpp"
 #include "../SpriteAnimation.hpp"
 #include "../Camera.hpp"
+#include "../Shape.hpp"
 #include "Size.hpp"
 #include "box2d/box2d.h"
 #include <numbers>
@@ -62,6 +63,40 @@ Object::Object(World* world, std::shared_ptr<Texture> texture, const Size& size,
     createFixture();
 }
 
+Object::Object(World* world, const std::vector<Rect>& rects, bool isDynamic, bool rotatable)
+    : world(world), type(Object::Type::Compound), color(Color(255, 255, 255, 255)), cornerRadius(0.0f),
+      width(0.0f), height(0.0f), radius(0.0f), texture(nullptr), sprite(nullptr), spriteAnimation(nullptr), rotatable(rotatable) {
+    id = UUID::randomUUID();
+
+    Point position;
+    if (!rects.empty()) {
+        float minX = rects[0].x;
+        float minY = rects[0].y;
+        float maxX = rects[0].x + rects[0].width;
+        float maxY = rects[0].y + rects[0].height;
+
+        for (const Rect& rect : rects) {
+            minX = std::min(minX, rect.x);
+            minY = std::min(minY, rect.y);
+            maxX = std::max(maxX, rect.x + rect.width);
+            maxY = std::max(maxY, rect.y + rect.height);
+        }
+
+        width = maxX - minX;
+        height = maxY - minY;
+        position = Point(minX + width / 2.0f, minY + height / 2.0f);
+    }
+
+    // stored relative to the body position
+    compoundRects.reserve(rects.size());
+    for (const Rect& rect : rects) {
+        compoundRects.push_back(Rect(rect.x - position.x, rect.y - position.y, rect.width, rect.height));
+    }
+
+    createBody(position, isDynamic);
+    createFixture();
+}
+
 Object::~Object() {
     if (B2_IS_NON_NULL(bodyId)) {
         b2DestroyBody(bodyId);
@@ -73,12 +108,24 @@ void Object::createBody(Point position, bool isDynamic) {
     bodyDef.type = isDynamic ? b2_dynamicBody : b2_staticBody;
     bodyDef.position = {position.x, position.y};
     bodyDef.fixedRotation = !rotatable;
+    bodyDef.userData = this;
     bodyId = b2CreateBody(world->getWorldId(), &bodyDef);
 }
 
 void Object::createFixture() {
+    for (b2ShapeId shape : getShapeIds()) {
+        b2DestroyShape(shape, true);
+    }
+    shapeId = b2_nullShapeId;
+
     b2ShapeDef shapeDef = b2DefaultShapeDef();
     shapeDef.density = 1.0f;
+    shapeDef.filter.categoryBits = categoryBits;
+    shapeDef.filter.maskBits = maskBits;
+    shapeDef.filter.groupIndex = groupIndex;
+    shapeDef.isSensor = sensor;
+    shapeDef.enableSensorEvents = true;
+    shapeDef.enableHitEvents = hitEvents;
 
     switch (type) {
         case Object::Type::Rect:
@@ -125,9 +172,53 @@ void Object::createFixture() {
             }
             break;
         }
+        case Object::Type::Compound: {
+            for (const Rect& rect : compoundRects) {
+                b2Vec2 center = {rect.x + rect.width / 2.0f, rect.y + rect.height / 2.0f};
+                b2Polygon box = b2MakeOffsetBox(rect.width / 2.0f, rect.height / 2.0f, center, b2Rot_identity);
+                shapeId = b2CreatePolygonShape(bodyId, &shapeDef, &box);
+            }
+            break;
+        }
     }
 }
 
+std::vector<b2ShapeId> Object::getShapeIds() const {
+    std::vector<b2ShapeId> shapeIds(b2Body_GetShapeCount(bodyId));
+    b2Body_GetShapes(bodyId, shapeIds.data(), static_cast<int>(shapeIds.size()));
+    return shapeIds;
+}
+
+std::shared_ptr<Shape> Object::getRenderShape() {
+
+    if (renderShape) {
+        return renderShape;
+    }
+
+    switch (type) {
+        case Object::Type::Rect:
+        case Object::Type::PixelPerfect:
+            renderShape = Renderer::createRectShape(Size(width, height));
+            break;
+        case Object::Type::Circle:
+            renderShape = Renderer::createCircleShape(radius);
+            break;
+        case Object::Type::RoundedRect:
+            renderShape = Renderer::createRoundedRectShape(Size(width, height), cornerRadius);
+            break;
+        case Object::Type::Triangle: {
+            Point center((trianglePoint1.x + trianglePoint2.x + trianglePoint3.x) / 3.0f,
+                        (trianglePoint1.y + trianglePoint2.y + trianglePoint3.y) / 3.0f);
+            renderShape = Renderer::createPolygonShape({trianglePoint1 - center, trianglePoint2 - center, trianglePoint3 - center});
+            break;
+        }
+        case Object::Type::Compound:
+            break;
+    }
+
+    return renderShape;
+}
+
 void Object::setPosition(Point position) {
     b2Body_SetTransform(bodyId, {position.x, position.y}, b2Body_GetRotation(bodyId));
 }
@@ -140,6 +231,7 @@ Point Object::getPosition() const {
 void Object::setSize(float width, float height) {
     this->width = width;
     this->height = height;
+    renderShape = nullptr;
     if (type != Object::Type::Circle) {
         createFixture();
     }
@@ -149,6 +241,7 @@ void Object::setRadius(float radius) {
     this->radius = radius;
     this->width = radius * 2;
     this->height = radius * 2;
+    renderShape = nullptr;
     if (type == Object::Type::Circle) {
         createFixture();
     }
@@ -177,6 +270,7 @@ void Object::setTrianglePoints(Point point1, Point point2, Point point3) {
     float maxY = std::max({point1.y, point2.y, point3.y});
     width = maxX - minX;
     height = maxY - minY;
+    renderShape = nullptr;
     
     if (type == Object::Type::Triangle) {
         createFixture();
@@ -196,15 +290,21 @@ Point Object::getTrianglePoint3() const {
 }
 
 void Object::setDensity(float density) {
-    b2Shape_SetDensity(shapeId, density, true);
+    for (b2ShapeId shape : getShapeIds()) {
+        b2Shape_SetDensity(shape, density, true);
+    }
 }
 
 void Object::setFriction(float friction) {
-    b2Shape_SetFriction(shapeId, friction);
+    for (b2ShapeId shape : getShapeIds()) {
+        b2Shape_SetFriction(shape, friction);
+    }
 }
 
 void Object::setRestitution(float restitution) {
-    b2Shape_SetRestitution(shapeId, restitution);
+    for (b2ShapeId shape : getShapeIds()) {
+        b2Shape_SetRestitution(shape, restitution);
+    }
 }
 
 void Object::setLinearVelocity(Point velocity) {
@@ -256,6 +356,7 @@ Color Object::getColor() const {
 
 void Object::setCornerRadius(float radius) {
     this->cornerRadius = radius;
+    renderShape = nullptr;
 }
 
 float Object::getCornerRadius() const {
@@ -313,12 +414,6 @@ bool Object::hasSpriteAnimation() const {
     return spriteAnimation != nullptr;
 }
 
-void Object::updateAnimation() {
-    if (spriteAnimation) {
-        spriteAnimation->update();
-    }
-}
-
 void Object::draw() {
     Point position = getPosition();
     float angle = getAngle();
@@ -341,7 +436,7 @@ void Object::draw() {
             } else if (texture) {
                 Renderer::drawTexture(texture, rect);
             } else {
-                Renderer::drawRect(rect, color);
+                Renderer::drawShape(getRenderShape(), rect.toPoint(), color);
             }
             break;
         }
@@ -349,7 +444,7 @@ void Object::draw() {
             if (texture) {
                 Renderer::drawCircleTexture(texture, position, radius);
             } else {
-                Renderer::drawCircle(position, radius, color);
+                Renderer::drawShape(getRenderShape(), position, color);
             }
             break;
         }
@@ -364,7 +459,7 @@ void Object::draw() {
             if (texture) {
                 Renderer::drawRoundedTexture(texture, rect, cornerRadius);
             } else {
-                Renderer::drawRoundedRect(rect, cornerRadius, color);
+                Renderer::drawShape(getRenderShape(), rect.toPoint(), color);
             }
             break;
         }
@@ -389,7 +484,7 @@ void Object::draw() {
             } else if (sprite) {
                 Renderer::drawSprite(sprite, Rect(worldPoint1.x, worldPoint1.y, width, height), spriteIndex);
             } else{
-                Renderer::drawTriangle(worldPoint1, worldPoint2, worldPoint3, color);
+                Renderer::drawShape(getRenderShape(), position, color);
             }
             break;
         }
@@ -403,7 +498,17 @@ void Object::draw() {
             if (texture) {
                 Renderer::drawTexture(texture, rect);
             } else {
-                Renderer::drawRect(rect, color);
+                Renderer::drawShape(getRenderShape(), rect.toPoint(), color);
+            }
+            break;
+        }
+        case Object::Type::Compound: {
+            if (angle != 0.0f) {
+                Renderer::rotate(Point(position.x, position.y), angle);
+            }
+
+            for (const Rect& rect : compoundRects) {
+                Renderer::drawRect(Rect(position.x + rect.x, position.y + rect.y, rect.width, rect.height), color);
             }
             break;
         }
@@ -421,4 +526,65 @@ void Object::setRotatable(bool rot)
 bool Object::isRotatable() const
 {
     return rotatable;
+}
+
+void Object::setVisible(bool visible)
+{
+    this->visible = visible;
+}
+
+bool Object::isVisible() const
+{
+    return visible;
+}
+
+void Object::setContactCallback(ContactCallback callback)
+{
+    contactCallback = std::move(callback);
+}
+
+void Object::setCollisionFilter(uint64_t categoryBits, uint64_t maskBits, int groupIndex)
+{
+    this->categoryBits = categoryBits;
+    this->maskBits = maskBits;
+    this->groupIndex = groupIndex;
+
+    b2Filter filter = b2DefaultFilter();
+    filter.categoryBits = categoryBits;
+    filter.maskBits = maskBits;
+    filter.groupIndex = groupIndex;
+    for (b2ShapeId shape : getShapeIds()) {
+        b2Shape_SetFilter(shape, filter);
+    }
+}
+
+uint64_t Object::getCategoryBits() const
+{
+    return categoryBits;
+}
+
+uint64_t Object::getMaskBits() const
+{
+    return maskBits;
+}
+
+void Object::setSensor(bool sensor)
+{
+    if (this->sensor == sensor) return;
+
+    this->sensor = sensor;
+    createFixture();
+}
+
+bool Object::isSensor() const
+{
+    return sensor;
+}
+
+void Object::setHitEvents(bool enabled)
+{
+    hitEvents = enabled;
+    for (b2ShapeId shape : getShapeIds()) {
+        b2Shape_EnableHitEvents(shape, enabled);
+    }
 }
\ No newline at end of file
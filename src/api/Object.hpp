@@ -4,7 +4,10 @@
 #include "Color.hpp"
 #include "UUID.hpp"
 #include "Size.hpp"
+#include "ContactEvent.hpp"
 #include <box2d/box2d.h>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -13,6 +16,7 @@ class Texture;
 class Sprite;
 class SpriteAnimation;
 class Camera;
+class Shape;
 
 class Object {
     public:
@@ -21,15 +25,20 @@ class Object {
             Circle,
             RoundedRect,
             Triangle,
-            PixelPerfect
+            PixelPerfect,
+            Compound
         };
 
+        using ContactCallback = std::function<void(const ContactEvent&)>;
+
         UUID id;
         
         Object(World* world, Object::Type type, Rect rect, bool isDynamic = true, bool rotatable = true);
         Object(World* world, Object::Type type, Point position, float radius, bool isDynamic = true, bool rotatable = true);
         Object(World* world, Object::Type type, Point point1, Point point2, Point point3, bool isDynamic = true, bool rotatable = true);
         Object(World* world, std::shared_ptr<Texture> texture, const Size& size, Point position = Point(0, 0), bool isDynamic = true, bool rotatable = true);
+        // one body with a box shape per rect, e.g. merged tile colliders
+        Object(World* world, const std::vector<Rect>& rects, bool isDynamic = false, bool rotatable = false);
         ~Object();
 
         void setPosition(Point position);
@@ -71,19 +80,27 @@ class Object {
         bool hasTexture() const;
         bool hasSprite() const;
         bool hasSpriteAnimation() const;
-        
-        void updateAnimation();
 
         void draw();
         bool isDynamic() const;
         void setDynamic(bool dynamic);
         void setRotatable(bool rotatable);
         bool isRotatable() const;
+        void setVisible(bool visible);
+        bool isVisible() const;
+
+        void setContactCallback(ContactCallback callback);
+        void setCollisionFilter(uint64_t categoryBits, uint64_t maskBits, int groupIndex = 0);
+        uint64_t getCategoryBits() const;
+        uint64_t getMaskBits() const;
+        void setSensor(bool sensor);
+        bool isSensor() const;
+        void setHitEvents(bool enabled);
         
     private:
         World* world;
         b2BodyId bodyId;
-        b2ShapeId shapeId;
+        b2ShapeId shapeId = b2_nullShapeId;
         Object::Type type;
         
         Color color;
@@ -92,15 +109,28 @@ class Object {
         Point trianglePoint1, trianglePoint2, trianglePoint3;
         
         std::vector<Point> pixelPerfectVertices;
+        std::vector<Rect> compoundRects;
         
         std::shared_ptr<Texture> texture;
         std::shared_ptr<Sprite> sprite;
         int spriteIndex;
         std::shared_ptr<SpriteAnimation> spriteAnimation;
         bool rotatable = true;
+        bool visible = true;
+
+        ContactCallback contactCallback;
+        uint64_t categoryBits = B2_DEFAULT_CATEGORY_BITS;
+        uint64_t maskBits = B2_DEFAULT_MASK_BITS;
+        int groupIndex = 0;
+        bool sensor = false;
+        bool hitEvents = false;
+        
+        std::shared_ptr<Shape> renderShape;
         
         void createBody(Point position, bool isDynamic);
         void createFixture();
+        std::vector<b2ShapeId> getShapeIds() const;
+        std::shared_ptr<Shape> getRenderShape();
         
         friend class World;
 };
\ No newline at end of file
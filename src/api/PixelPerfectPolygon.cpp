@@ -122,7 +122,7 @@ std::vector<std::vector<Point>> PixelPerfectPolygon::extractPolygons(
     const Size& targetSize,
     float alphaThreshold,
     float simplificationTolerance) {
-    if (!texture || !texture->getPixelData()) {
+    if (!texture || !texture->requirePixelData()) {
         return {};
     }
 
@@ -0,0 +1,20 @@
+#pragma once
+#include "Point.hpp"
+#include <box2d/box2d.h>
+#include <cstdint>
+
+class Object;
+
+struct QueryFilter {
+    uint64_t categoryBits = B2_DEFAULT_CATEGORY_BITS;
+    uint64_t maskBits = B2_DEFAULT_MASK_BITS;
+};
+
+struct RaycastHit {
+    Object* object = nullptr;
+    Point point;
+    Point normal;
+    float fraction = 1.0f;
+
+    explicit operator bool() const { return object != nullptr; }
+};
\ No newline at end of file
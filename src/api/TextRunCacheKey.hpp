@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CacheManager.hpp"
+#include <string>
+
+struct TextRunCacheKey : public CacheKeyBase<TextRunCacheKey> {
+
+    std::string text;
+    int fontHandle;
+    float fontSize;
+    int align;
+    
+    TextRunCacheKey() = default;
+    
+    TextRunCacheKey(const std::string& text, int fontHandle, float fontSize, int align = 0)
+        : text(text), fontHandle(fontHandle), fontSize(fontSize), align(align) {}
+    
+    bool operator==(const TextRunCacheKey& other) const {
+        return text == other.text &&
+               fontHandle == other.fontHandle &&
+               fontSize == other.fontSize &&
+               align == other.align;
+    }
+    
+    bool operator!=(const TextRunCacheKey& other) const {
+        return !(*this == other);
+    }
+    
+    bool isEqual(const TextRunCacheKey& other) const {
+        return *this == other;
+    }
+    
+    std::size_t getHash() const {
+        return calculateHash(text, fontHandle, fontSize, align);
+    }
+};
+
+struct TextRunCacheKeyHash : public CacheKeyHashBase<TextRunCacheKey> {
+};
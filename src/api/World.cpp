@@ -4,13 +4,30 @@
 #include "../Window.hpp"
 #include "../Camera.hpp"
 #include "../Texture.hpp"
+#include "../JobSystem.hpp"
 #include "Rect.hpp"
 #include "Size.hpp"
 #include <algorithm>
 
-World::World(Point gravity) {
+World::World(Point gravity, int workerCount) {
+    int available = JobSystem::getAvailableWorkers();
+    this->workerCount = workerCount > 0 ? std::min(workerCount, available) : available;
+
+    if (this->workerCount > 1) {
+        JobSystem::init();
+        this->workerCount = std::min(this->workerCount, JobSystem::getWorkerCount());
+    }
+
     b2WorldDef worldDef = b2DefaultWorldDef();
     worldDef.gravity = {gravity.x, gravity.y};
+
+    if (this->workerCount > 1) {
+        worldDef.workerCount = this->workerCount;
+        worldDef.enqueueTask = &World::enqueueTask;
+        worldDef.finishTask = &World::finishTask;
+        worldDef.userTaskContext = this;
+    }
+
     worldId = b2CreateWorld(&worldDef);
 }
 
@@ -25,6 +42,237 @@ World::~World() {
 void World::step(int subStepCount) {
     float deltaTime = Window::getDeltaTime() / 1000.0f;
     b2World_Step(worldId, deltaTime, subStepCount);
+    dispatchContactEvents();
+}
+
+void* World::enqueueTask(b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext) {
+    World* world = static_cast<World*>(userContext);
+    return JobSystem::enqueue(task, itemCount, minRange, taskContext, world->workerCount);
+}
+
+void World::finishTask(void* userTask, void* userContext) {
+    JobSystem::wait(static_cast<JobSystem::Job*>(userTask));
+}
+
+int World::getWorkerCount() const {
+    return workerCount;
+}
+
+void World::setContactListener(ContactListener listener) {
+    contactListener = std::move(listener);
+}
+
+Object* World::getObject(b2ShapeId shapeId) {
+    if (!b2Shape_IsValid(shapeId)) {
+        return nullptr;
+    }
+
+    return static_cast<Object*>(b2Body_GetUserData(b2Shape_GetBody(shapeId)));
+}
+
+b2QueryFilter World::toQueryFilter(QueryFilter filter) {
+    b2QueryFilter queryFilter = b2DefaultQueryFilter();
+    queryFilter.categoryBits = filter.categoryBits;
+    queryFilter.maskBits = filter.maskBits;
+    return queryFilter;
+}
+
+b2ShapeProxy World::makeProxy(std::span<const Point> points, float radius) {
+    b2Vec2 vertices[B2_MAX_POLYGON_VERTICES];
+    int count = static_cast<int>(std::min(points.size(), static_cast<size_t>(B2_MAX_POLYGON_VERTICES)));
+
+    for (int i = 0; i < count; ++i) {
+        vertices[i] = {points[i].x, points[i].y};
+    }
+
+    return b2MakeProxy(vertices, count, radius);
+}
+
+bool World::raycast(Point origin, Point translation, RaycastHit& hit, QueryFilter filter) const {
+    hit = RaycastHit();
+
+    raycastAll(origin, translation, [&hit](const RaycastHit& candidate) {
+        hit = candidate;
+        return candidate.fraction;
+    }, filter);
+
+    return hit.object != nullptr;
+}
+
+void World::raycastBatch(std::span<const Point> origins, std::span<const Point> translations, std::span<RaycastHit> hits, QueryFilter filter) const {
+    size_t count = std::min({origins.size(), translations.size(), hits.size()});
+
+    for (size_t i = 0; i < count; ++i) {
+        raycast(origins[i], translations[i], hits[i], filter);
+    }
+}
+
+void World::raycastBatch(Point origin, std::span<const Point> translations, std::span<RaycastHit> hits, QueryFilter filter) const {
+    size_t count = std::min(translations.size(), hits.size());
+
+    for (size_t i = 0; i < count; ++i) {
+        raycast(origin, translations[i], hits[i], filter);
+    }
+}
+
+bool World::castCircle(Point center, float radius, Point translation, RaycastHit& hit, QueryFilter filter) const {
+    hit = RaycastHit();
+
+    castShape(std::span<const Point>(&center, 1), radius, translation, [&hit](const RaycastHit& candidate) {
+        hit = candidate;
+        return candidate.fraction;
+    }, filter);
+
+    return hit.object != nullptr;
+}
+
+bool World::castPolygon(std::span<const Point> points, Point translation, RaycastHit& hit, QueryFilter filter) const {
+    hit = RaycastHit();
+
+    if (points.empty()) {
+        return false;
+    }
+
+    castShape(points, 0.0f, translation, [&hit](const RaycastHit& candidate) {
+        hit = candidate;
+        return candidate.fraction;
+    }, filter);
+
+    return hit.object != nullptr;
+}
+
+std::vector<Object*> World::queryAABB(Rect rect, QueryFilter filter) const {
+    std::vector<Object*> result;
+
+    queryAABB(rect, [&result](Object* object) {
+        result.push_back(object);
+        return true;
+    }, filter);
+
+    return result;
+}
+
+std::vector<Object*> World::queryCircle(Point center, float radius, QueryFilter filter) const {
+    std::vector<Object*> result;
+
+    queryCircle(center, radius, [&result](Object* object) {
+        result.push_back(object);
+        return true;
+    }, filter);
+
+    return result;
+}
+
+Object* World::queryPoint(Point point, QueryFilter filter) const {
+    struct PointQuery {
+        b2Vec2 point;
+        Object* object;
+    };
+
+    PointQuery query = {{point.x, point.y}, nullptr};
+    b2AABB aabb = {query.point, query.point};
+
+    b2World_OverlapAABB(worldId, aabb, toQueryFilter(filter), [](b2ShapeId shapeId, void* context) {
+        auto* query = static_cast<PointQuery*>(context);
+        if (!b2Shape_TestPoint(shapeId, query->point)) {
+            return true;
+        }
+
+        query->object = getObject(shapeId);
+        return query->object == nullptr;
+    }, &query);
+
+    return query.object;
+}
+
+void World::dispatch(const ContactEvent& event) {
+    if (!event.object || !event.other) {
+        return;
+    }
+
+    if (contactListener) {
+        contactListener(event);
+    }
+
+    if (event.object->contactCallback) {
+        event.object->contactCallback(event);
+    }
+
+    if (event.other->contactCallback) {
+        ContactEvent swapped = event;
+        swapped.object = event.other;
+        swapped.other = event.object;
+        swapped.normal = -event.normal;
+        event.other->contactCallback(swapped);
+    }
+}
+
+void World::dispatchContactEvents() {
+    dispatchingEvents = true;
+
+    b2ContactEvents contacts = b2World_GetContactEvents(worldId);
+
+    for (int i = 0; i < contacts.beginCount; ++i) {
+        const b2ContactBeginTouchEvent& contact = contacts.beginEvents[i];
+        ContactEvent event;
+        event.type = ContactEvent::Type::Begin;
+        event.object = getObject(contact.shapeIdA);
+        event.other = getObject(contact.shapeIdB);
+        event.normal = Point(contact.manifold.normal.x, contact.manifold.normal.y);
+        if (contact.manifold.pointCount > 0) {
+            event.point = Point(contact.manifold.points[0].point.x, contact.manifold.points[0].point.y);
+        }
+        dispatch(event);
+    }
+
+    for (int i = 0; i < contacts.endCount; ++i) {
+        const b2ContactEndTouchEvent& contact = contacts.endEvents[i];
+        ContactEvent event;
+        event.type = ContactEvent::Type::End;
+        event.object = getObject(contact.shapeIdA);
+        event.other = getObject(contact.shapeIdB);
+        dispatch(event);
+    }
+
+    for (int i = 0; i < contacts.hitCount; ++i) {
+        const b2ContactHitEvent& contact = contacts.hitEvents[i];
+        ContactEvent event;
+        event.type = ContactEvent::Type::Hit;
+        event.object = getObject(contact.shapeIdA);
+        event.other = getObject(contact.shapeIdB);
+        event.point = Point(contact.point.x, contact.point.y);
+        event.normal = Point(contact.normal.x, contact.normal.y);
+        event.approachSpeed = contact.approachSpeed;
+        dispatch(event);
+    }
+
+    b2SensorEvents sensors = b2World_GetSensorEvents(worldId);
+
+    for (int i = 0; i < sensors.beginCount; ++i) {
+        const b2SensorBeginTouchEvent& sensor = sensors.beginEvents[i];
+        ContactEvent event;
+        event.type = ContactEvent::Type::SensorBegin;
+        event.object = getObject(sensor.sensorShapeId);
+        event.other = getObject(sensor.visitorShapeId);
+        dispatch(event);
+    }
+
+    for (int i = 0; i < sensors.endCount; ++i) {
+        const b2SensorEndTouchEvent& sensor = sensors.endEvents[i];
+        ContactEvent event;
+        event.type = ContactEvent::Type::SensorEnd;
+        event.object = getObject(sensor.sensorShapeId);
+        event.other = getObject(sensor.visitorShapeId);
+        dispatch(event);
+    }
+
+    dispatchingEvents = false;
+
+    for (auto& object : pendingDestroy) {
+        destroyObject(object);
+    }
+
+    pendingDestroy.clear();
 }
 
 void World::setGravity(Point gravity) {
@@ -61,6 +309,12 @@ std::shared_ptr<Object> World::createTriangleObject(Point point1, Point point2,
     return object;
 }
 
+std::shared_ptr<Object> World::createCompoundObject(const std::vector<Rect>& rects, bool isDynamic, bool rotatable) {
+    auto object = std::make_shared<Object>(this, rects, isDynamic, rotatable);
+    objects.push_back(object);
+    return object;
+}
+
 std::vector<std::shared_ptr<Object>> World::createPixelPerfectObjects(std::shared_ptr<Texture> texture, Rect rect, bool isDynamic, bool rotatable) {
     
     std::vector<std::shared_ptr<Object>> result;
@@ -94,6 +348,11 @@ std::vector<std::shared_ptr<Object>> World::createPixelPerfectObjects(std::share
 }
 
 void World::destroyObject(std::shared_ptr<Object> object) {
+    if (dispatchingEvents) {
+        pendingDestroy.push_back(object);
+        return;
+    }
+
     objects.erase(
         std::remove_if(objects.begin(), objects.end(),
             [object](const std::shared_ptr<Object>& obj) {
@@ -105,7 +364,9 @@ void World::destroyObject(std::shared_ptr<Object> object) {
 
 void World::drawAll() {
     for (const auto& object : objects) {
-        object->draw();
+        if (object->isVisible()) {
+            object->draw();
+        }
     }
 }
 
@@ -164,7 +425,7 @@ std::vector<std::vector<Point>> World::extractPolygonsWithCache(
     float alphaThreshold,
     float simplificationTolerance) {
     
-    if (!texture || !texture->getPixelData()) {
+    if (!texture || !texture->requirePixelData()) {
         return {};
     }
 
@@ -3,9 +3,13 @@
 #include "Rect.hpp"
 #include "Size.hpp"
 #include "PixelPerfectPolygon.hpp"
+#include "ContactEvent.hpp"
+#include "RaycastHit.hpp"
 #include <box2d/box2d.h>
+#include <functional>
 #include <vector>
 #include <memory>
+#include <span>
 #include "Window.hpp"
 #include <type_traits>
 
@@ -16,12 +20,16 @@ class Texture;
 
 class World {
     public:
-        World(Point gravity = Point(0.0f, -98.0f));
+        using ContactListener = std::function<void(const ContactEvent&)>;
+
+        World(Point gravity = Point(0.0f, -98.0f), int workerCount = 0);
         ~World();
 
         void step(int subStepCount = 4);
         void setGravity(Point gravity);
         Point getGravity() const;
+        int getWorkerCount() const;
+        void setContactListener(ContactListener listener);
 
         std::shared_ptr<Object> createRectObject(Rect rect, bool isDynamic = true, bool rotatable = true);
 
@@ -63,6 +71,8 @@ class World {
             return obj;
         }
 
+        std::shared_ptr<Object> createCompoundObject(const std::vector<Rect>& rects, bool isDynamic = false, bool rotatable = false);
+
         template<typename T, typename... Args>
         std::shared_ptr<T> createObject(Args&&... args) {
             static_assert(std::is_base_of<Object, T>::value, "T must derive from Object");
@@ -107,12 +117,104 @@ class World {
         void clearPolygonCache();
         size_t getPolygonCacheSize() const;
 
+        bool raycast(Point origin, Point translation, RaycastHit& hit, QueryFilter filter = QueryFilter()) const;
+        void raycastBatch(std::span<const Point> origins, std::span<const Point> translations, std::span<RaycastHit> hits, QueryFilter filter = QueryFilter()) const;
+        void raycastBatch(Point origin, std::span<const Point> translations, std::span<RaycastHit> hits, QueryFilter filter = QueryFilter()) const;
+
+        // callback returns the fraction to clip the ray to: -1 ignores the hit, 0 stops, 1 continues unclipped
+        template<typename Callback>
+        void raycastAll(Point origin, Point translation, Callback&& callback, QueryFilter filter = QueryFilter()) const {
+            b2World_CastRay(worldId, {origin.x, origin.y}, {translation.x, translation.y}, toQueryFilter(filter), &castCallback<std::remove_reference_t<Callback>>, toContext(callback));
+        }
+
+        bool castCircle(Point center, float radius, Point translation, RaycastHit& hit, QueryFilter filter = QueryFilter()) const;
+        bool castPolygon(std::span<const Point> points, Point translation, RaycastHit& hit, QueryFilter filter = QueryFilter()) const;
+
+        template<typename Callback>
+        void castShape(std::span<const Point> points, float radius, Point translation, Callback&& callback, QueryFilter filter = QueryFilter()) const {
+            b2ShapeProxy proxy = makeProxy(points, radius);
+            b2World_CastShape(worldId, &proxy, {translation.x, translation.y}, toQueryFilter(filter), &castCallback<std::remove_reference_t<Callback>>, toContext(callback));
+        }
+
+        std::vector<Object*> queryAABB(Rect rect, QueryFilter filter = QueryFilter()) const;
+        std::vector<Object*> queryCircle(Point center, float radius, QueryFilter filter = QueryFilter()) const;
+        Object* queryPoint(Point point, QueryFilter filter = QueryFilter()) const;
+
+        // callback returns false to stop the query
+        template<typename Callback>
+        void queryAABB(Rect rect, Callback&& callback, QueryFilter filter = QueryFilter()) const {
+            AABBQuery<std::remove_reference_t<Callback>> query{{{rect.x, rect.y}, {rect.x + rect.width, rect.y + rect.height}}, callback};
+            b2World_OverlapAABB(worldId, query.aabb, toQueryFilter(filter), &aabbCallback<std::remove_reference_t<Callback>>, &query);
+        }
+
+        template<typename Callback>
+        void queryCircle(Point center, float radius, Callback&& callback, QueryFilter filter = QueryFilter()) const {
+            b2Vec2 point = {center.x, center.y};
+            b2ShapeProxy proxy = b2MakeProxy(&point, 1, radius);
+            b2World_OverlapShape(worldId, &proxy, toQueryFilter(filter), &overlapCallback<std::remove_reference_t<Callback>>, toContext(callback));
+        }
+
         b2WorldId getWorldId() const { return worldId; }
 
     private:
         b2WorldId worldId;
+        int workerCount = 1;
         std::vector<std::shared_ptr<Object>> objects;
         mutable PixelPerfectPolygon::PolygonCache polygonCache;
+        ContactListener contactListener;
+        bool dispatchingEvents = false;
+        std::vector<std::shared_ptr<Object>> pendingDestroy;
+
+        void dispatchContactEvents();
+        void dispatch(const ContactEvent& event);
+        static Object* getObject(b2ShapeId shapeId);
+        static void* enqueueTask(b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext);
+        static void finishTask(void* userTask, void* userContext);
+        static b2QueryFilter toQueryFilter(QueryFilter filter);
+        static b2ShapeProxy makeProxy(std::span<const Point> points, float radius);
+
+        template<typename T>
+        static void* toContext(T& value) {
+            return const_cast<void*>(static_cast<const void*>(&value));
+        }
+
+        template<typename Callback>
+        static float castCallback(b2ShapeId shapeId, b2Vec2 point, b2Vec2 normal, float fraction, void* context) {
+            Object* object = getObject(shapeId);
+            if (!object) {
+                return -1.0f;
+            }
+
+            RaycastHit hit{object, Point(point.x, point.y), Point(normal.x, normal.y), fraction};
+            return (*static_cast<Callback*>(context))(hit);
+        }
+
+        template<typename Callback>
+        static bool overlapCallback(b2ShapeId shapeId, void* context) {
+            Object* object = getObject(shapeId);
+            if (!object) {
+                return true;
+            }
+
+            return (*static_cast<Callback*>(context))(object);
+        }
+
+        template<typename Callback>
+        struct AABBQuery {
+            b2AABB aabb;
+            Callback& callback;
+        };
+
+        // the broadphase reports fattened proxy bounds, keep only shapes whose own bounds overlap
+        template<typename Callback>
+        static bool aabbCallback(b2ShapeId shapeId, void* context) {
+            auto* query = static_cast<AABBQuery<Callback>*>(context);
+            if (!b2AABB_Overlaps(b2Shape_GetAABB(shapeId), query->aabb)) {
+                return true;
+            }
+
+            return overlapCallback<Callback>(shapeId, toContext(query->callback));
+        }
         
         friend class Object;
 };
\ No newline at end of file
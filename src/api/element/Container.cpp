@@ -1,4 +1,9 @@
 #include "Container.hpp"
+#include "../../Renderer.hpp"
+#include "../../Mouse.hpp"
+#include "../../Window.hpp"
+#include <algorithm>
+#include <cmath>
 
 VBoxContainer::VBoxContainer() {
     setLayoutMode(LayoutMode::Column);
@@ -84,7 +89,14 @@ void GridContainer::setElement(int column, int row, std::shared_ptr<Element> ele
         gridItems.push_back({element, column, row});
     }
     
-    rebuildLayout();
+    if (element) {
+        std::erase_if(gridItems, [&element, column, row](const GridItem& item) {
+            return item.element == element && (item.column != column || item.row != row);
+        });
+    }
+    
+    ensureRows(calculateRows());
+    placeElement(column, row, element);
 }
 
 void GridContainer::setElement(int index, std::shared_ptr<Element> element) {
@@ -131,12 +143,20 @@ void GridContainer::setGap(float gap) {
 
 void GridContainer::setColumnGap(float gap) {
     columnGap = gap;
-    rebuildLayout();
+    
+    for (auto& rowContainer : rowContainers) {
+        for (size_t c = 1; c < rowContainer->getChildCount(); ++c) {
+            rowContainer->getChild(c)->setMargin(0, 0, 0, columnGap);
+        }
+    }
 }
 
 void GridContainer::setRowGap(float gap) {
     rowGap = gap;
-    rebuildLayout();
+    
+    for (size_t r = 1; r < rowContainers.size(); ++r) {
+        rowContainers[r]->setMargin(rowGap, 0, 0, 0);
+    }
 }
 
 void GridContainer::setAutoFlow(bool columnFirst) {
@@ -159,30 +179,60 @@ void GridContainer::createGridStructure() {
     columnContainers.clear();
     rowContainers.clear();
     
-    int actualRows = calculateRows();
-    
     YGNodeStyleSetFlexDirection(yogaNode, YGFlexDirectionColumn);
     
-    for (int r = 0; r < actualRows; ++r) {
+    ensureRows(calculateRows());
+}
+
+void GridContainer::ensureRows(int count) {
+    while (static_cast<int>(rowContainers.size()) < count) {
+        appendRow();
+    }
+}
 
-        auto rowContainer = std::make_shared<HBoxContainer>();
-        rowContainer->setFlexGrow(1.0f);
+void GridContainer::appendRow() {
 
-        if (r > 0 && rowGap > 0) {
-            rowContainer->setMargin(rowGap, 0, 0, 0);
+    int r = static_cast<int>(rowContainers.size());
+
+    auto rowContainer = std::make_shared<HBoxContainer>();
+    rowContainer->setFlexGrow(1.0f);
+
+    if (r > 0 && rowGap > 0) {
+        rowContainer->setMargin(rowGap, 0, 0, 0);
+    }
+    
+    for (int c = 0; c < columns; ++c) {
+        auto cellContainer = std::make_shared<Element>();
+        cellContainer->setFlexGrow(1.0f);
+        if (c > 0 && columnGap > 0) {
+            cellContainer->setMargin(0, 0, 0, columnGap);
         }
-        
-        for (int c = 0; c < columns; ++c) {
-            auto cellContainer = std::make_shared<Element>();
-            cellContainer->setFlexGrow(1.0f);
-            if (c > 0 && columnGap > 0) {
-                cellContainer->setMargin(0, 0, 0, columnGap);
-            }
-            rowContainer->addChild(cellContainer);
+        rowContainer->addChild(cellContainer);
+    }
+    
+    addChild(rowContainer);
+    rowContainers.push_back(rowContainer);
+}
+
+void GridContainer::placeElement(int column, int row, std::shared_ptr<Element> element) {
+
+    if (row < 0 || row >= static_cast<int>(rowContainers.size())) {
+        return;
+    }
+
+    auto cellContainer = rowContainers[row]->getChild(column);
+
+    if (!cellContainer) {
+        return;
+    }
+
+    cellContainer->clearChildren();
+
+    if (element) {
+        if (Element* parent = element->getParent()) {
+            parent->removeChild(element);
         }
-        
-        addChild(rowContainer);
-        rowContainers.push_back(rowContainer);
+        cellContainer->addChild(element);
     }
 }
 
@@ -190,13 +240,199 @@ void GridContainer::rebuildLayout() {
     createGridStructure();
     
     for (const auto& item : gridItems) {
-        if (item.row < static_cast<int>(rowContainers.size())) {
-            auto rowContainer = std::static_pointer_cast<HBoxContainer>(rowContainers[item.row]);
-            if (item.column < static_cast<int>(rowContainer->getChildCount())) {
-                auto cellContainer = rowContainer->getChild(item.column);
-                cellContainer->clearChildren();
-                cellContainer->addChild(item.element);
+        placeElement(item.column, item.row, item.element);
+    }
+}
+
+
+VirtualListContainer::VirtualListContainer(int itemCount, ItemHeightFunction itemHeight, BindFunction bind, CreateFunction create)
+    : itemCount(std::max(itemCount, 0)), itemHeight(itemHeight), bind(bind), create(create) {
+    setLayoutMode(LayoutMode::Manual);
+    YGNodeStyleSetOverflow(yogaNode, YGOverflowHidden);
+    rebuildOffsets();
+}
+
+void VirtualListContainer::setSpacing(float spacing) {
+    this->spacing = spacing;
+    invalidateItems();
+}
+
+void VirtualListContainer::setAlignment(AlignItems align) {
+    alignment = align;
+    setAlignItems(align);
+
+    for (auto& row : rows) {
+        applyAlignment(row.element);
+    }
+    for (auto& element : rowPool) {
+        applyAlignment(element);
+    }
+}
+
+void VirtualListContainer::setItemCount(int count) {
+    itemCount = std::max(count, 0);
+    invalidateItems();
+}
+
+void VirtualListContainer::invalidateItems() {
+    rebuildOffsets();
+    scrollOffset = clampScroll(scrollOffset);
+    refresh();
+}
+
+void VirtualListContainer::refresh() {
+    for (auto& row : rows) {
+        recycleRow(row);
+    }
+    rows.clear();
+    updateRows();
+}
+
+void VirtualListContainer::scrollTo(float offset) {
+    scrollVelocity = 0.0f;
+    scrollOffset = clampScroll(offset);
+    updateRows();
+}
+
+void VirtualListContainer::scrollToItem(int index) {
+    if (itemCount == 0) return;
+    scrollTo(itemOffsets[std::clamp(index, 0, itemCount - 1)]);
+}
+
+float VirtualListContainer::getContentHeight() const {
+    return itemCount > 0 ? itemOffsets[itemCount] - spacing : 0.0f;
+}
+
+void VirtualListContainer::update() {
+    if (visible) {
+        float deltaSeconds = Window::getDeltaTime() / 1000.0f;
+
+        if (Mouse::isInside(getAbsoluteBounds())) {
+            float scroll = Mouse::getScrollY();
+            if (scroll != 0.0f) {
+                scrollVelocity += scroll * scrollSpeed;
             }
         }
+
+        if (scrollVelocity != 0.0f) {
+            scrollOffset = clampScroll(scrollOffset + scrollVelocity * deltaSeconds);
+            scrollVelocity *= std::exp(-friction * deltaSeconds);
+
+            if (std::abs(scrollVelocity) < 1.0f || scrollOffset <= 0.0f || scrollOffset >= clampScroll(getContentHeight())) {
+                scrollVelocity = 0.0f;
+            }
+        }
+
+        updateRows();
+    }
+
+    Element::update();
+}
+
+void VirtualListContainer::drawChildren() {
+    Renderer::save();
+    Renderer::scisor(getAbsoluteBounds());
+    Element::drawChildren();
+    Renderer::restore();
+}
+
+void VirtualListContainer::rebuildOffsets() {
+    itemOffsets.resize(itemCount + 1);
+    itemOffsets[0] = 0.0f;
+    for (int i = 0; i < itemCount; i++) {
+        itemOffsets[i + 1] = itemOffsets[i] + itemHeight(i) + spacing;
     }
 }
+
+int VirtualListContainer::findItem(float offset) const {
+    auto it = std::upper_bound(itemOffsets.begin(), itemOffsets.end(), offset);
+    int index = static_cast<int>(it - itemOffsets.begin()) - 1;
+    return std::clamp(index, 0, std::max(itemCount - 1, 0));
+}
+
+float VirtualListContainer::clampScroll(float offset) const {
+    return std::clamp(offset, 0.0f, std::max(getContentHeight() - viewportHeight, 0.0f));
+}
+
+void VirtualListContainer::updateRows() {
+    viewportHeight = getAbsoluteBounds().height;
+    scrollOffset = clampScroll(scrollOffset);
+
+    int first = 0;
+    int last = -1;
+    if (itemCount > 0 && viewportHeight > 0) {
+        first = findItem(scrollOffset);
+        last = findItem(scrollOffset + viewportHeight);
+    }
+
+    auto outside = std::remove_if(rows.begin(), rows.end(), [&](const Row& row) {
+        if (row.index >= first && row.index <= last) return false;
+        recycleRow(row);
+        return true;
+    });
+    rows.erase(outside, rows.end());
+
+    for (int index = first; index <= last; index++) {
+        auto it = std::find_if(rows.begin(), rows.end(), [index](const Row& row) {
+            return row.index == index;
+        });
+
+        if (it == rows.end()) {
+            Row row = { index, acquireRow() };
+            bind(index, row.element);
+            rows.push_back(row);
+        }
+    }
+
+    for (auto& row : rows) {
+        placeRow(row);
+    }
+}
+
+void VirtualListContainer::placeRow(const Row& row) {
+    YGNodeRef node = row.element->getYogaNode();
+    float top = itemOffsets[row.index] - scrollOffset;
+    float height = itemOffsets[row.index + 1] - itemOffsets[row.index] - spacing;
+
+    if (YGNodeStyleGetPosition(node, YGEdgeTop).value != top) {
+        YGNodeStyleSetPosition(node, YGEdgeTop, top);
+    }
+    if (YGNodeStyleGetHeight(node).value != height) {
+        YGNodeStyleSetHeight(node, height);
+    }
+}
+
+std::shared_ptr<Element> VirtualListContainer::acquireRow() {
+    std::shared_ptr<Element> element;
+    if (!rowPool.empty()) {
+        element = rowPool.back();
+        rowPool.pop_back();
+    } else {
+        element = create ? create() : std::make_shared<Element>();
+        element->setPositionType(PositionType::Absolute);
+        applyAlignment(element);
+    }
+
+    addChild(element);
+    return element;
+}
+
+void VirtualListContainer::applyAlignment(std::shared_ptr<Element> element) {
+    YGNodeRef node = element->getYogaNode();
+
+    if (alignment == AlignItems::Stretch) {
+        YGNodeStyleSetPosition(node, YGEdgeLeft, 0.0f);
+        YGNodeStyleSetWidthPercent(node, 100.0f);
+        return;
+    }
+
+    YGNodeStyleSetPosition(node, YGEdgeLeft, YGUndefined);
+    if (YGNodeStyleGetWidth(node).unit == YGUnitPercent) {
+        YGNodeStyleSetWidthAuto(node);
+    }
+}
+
+void VirtualListContainer::recycleRow(const Row& row) {
+    removeChild(row.element);
+    rowPool.push_back(row.element);
+}
\ No newline at end of file
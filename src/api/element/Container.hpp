@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Element.hpp"
+#include <functional>
 
 class Container : public Element {
     public:
@@ -116,4 +117,68 @@ class GridContainer : public AdvancedContainer {
         
         int calculateRows() const;
         void createGridStructure();
+        void ensureRows(int count);
+        void appendRow();
+        void placeElement(int column, int row, std::shared_ptr<Element> element);
 };
+
+
+class VirtualListContainer : public Container {
+    public:
+        using ItemHeightFunction = std::function<float(int index)>;
+        using BindFunction = std::function<void(int index, std::shared_ptr<Element> row)>;
+        using CreateFunction = std::function<std::shared_ptr<Element>()>;
+
+        VirtualListContainer(int itemCount, ItemHeightFunction itemHeight, BindFunction bind, CreateFunction create = nullptr);
+
+        void setSpacing(float spacing) override;
+        void setAlignment(AlignItems align) override;
+
+        void setItemCount(int count);
+        int getItemCount() const { return itemCount; }
+        void invalidateItems();
+        void refresh();
+
+        void scrollTo(float offset);
+        void scrollToItem(int index);
+        float getScrollOffset() const { return scrollOffset; }
+        float getContentHeight() const;
+
+        void setScrollSpeed(float speed) { scrollSpeed = speed; }
+        void setFriction(float friction) { this->friction = friction; }
+
+        void update() override;
+
+    protected:
+        void drawChildren() override;
+
+    private:
+        struct Row {
+            int index;
+            std::shared_ptr<Element> element;
+        };
+
+        int itemCount;
+        ItemHeightFunction itemHeight;
+        BindFunction bind;
+        CreateFunction create;
+
+        std::vector<float> itemOffsets;
+        std::vector<Row> rows;
+        std::vector<std::shared_ptr<Element>> rowPool;
+
+        float scrollOffset = 0.0f;
+        float scrollVelocity = 0.0f;
+        float scrollSpeed = 2400.0f;
+        float friction = 8.0f;
+        float viewportHeight = 0.0f;
+
+        void rebuildOffsets();
+        int findItem(float offset) const;
+        float clampScroll(float offset) const;
+        void updateRows();
+        void placeRow(const Row& row);
+        std::shared_ptr<Element> acquireRow();
+        void applyAlignment(std::shared_ptr<Element> element);
+        void recycleRow(const Row& row);
+};
\ No newline at end of file
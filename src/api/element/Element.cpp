@@ -3,6 +3,8 @@
 #include "../../Texture.hpp"
 #include "../../Sprite.hpp"
 #include "../../SpriteAnimation.hpp"
+#include "../../Shape.hpp"
+#include "../../Layer.hpp"
 
 Element::Element() 
     : currentLayoutMode(LayoutMode::Manual), layoutLocked(false),
@@ -12,6 +14,9 @@ Element::Element()
 }
 
 Element::~Element() {
+    if (layer) {
+        Renderer::cancelLayer(layer);
+    }
     YGNodeFree(yogaNode);
 }
 
@@ -94,24 +99,32 @@ void Element::addTopElement(std::shared_ptr<Element> element) {
     ensureLayoutMode(LayoutMode::Column);
     YGNodeInsertChild(yogaNode, element->yogaNode, 0);
     children.insert(children.begin(), element);
+    treeVersion++;
+    markDirty();
 }
 
 void Element::addBottomElement(std::shared_ptr<Element> element) {
     ensureLayoutMode(LayoutMode::Column);
     YGNodeInsertChild(yogaNode, element->yogaNode, YGNodeGetChildCount(yogaNode));
     children.push_back(element);
+    treeVersion++;
+    markDirty();
 }
 
 void Element::addLeftElement(std::shared_ptr<Element> element) {
     ensureLayoutMode(LayoutMode::Row);
     YGNodeInsertChild(yogaNode, element->yogaNode, 0);
     children.insert(children.begin(), element);
+    treeVersion++;
+    markDirty();
 }
 
 void Element::addRightElement(std::shared_ptr<Element> element) {
     ensureLayoutMode(LayoutMode::Row);
     YGNodeInsertChild(yogaNode, element->yogaNode, YGNodeGetChildCount(yogaNode));
     children.push_back(element);
+    treeVersion++;
+    markDirty();
 }
 
 void Element::addCenterElement(std::shared_ptr<Element> element) {
@@ -122,6 +135,8 @@ void Element::addCenterElement(std::shared_ptr<Element> element) {
 void Element::addChild(std::shared_ptr<Element> element) {
     YGNodeInsertChild(yogaNode, element->yogaNode, YGNodeGetChildCount(yogaNode));
     children.push_back(element);
+    treeVersion++;
+    markDirty();
 }
 
 void Element::removeChild(std::shared_ptr<Element> element) {
@@ -129,6 +144,8 @@ void Element::removeChild(std::shared_ptr<Element> element) {
     if (it != children.end()) {
         YGNodeRemoveChild(yogaNode, element->yogaNode);
         children.erase(it);
+        treeVersion++;
+        markDirty();
     }
 }
 
@@ -137,6 +154,8 @@ void Element::clearChildren() {
         YGNodeRemoveChild(yogaNode, child->yogaNode);
     }
     children.clear();
+    treeVersion++;
+    markDirty();
 }
 
 void Element::setLayoutMode(LayoutMode mode) {
@@ -202,20 +221,93 @@ void Element::setFillHeight() {
 
 void Element::calculateLayout(float parentWidth, float parentHeight) {
     YGNodeCalculateLayout(yogaNode, parentWidth, parentHeight, YGDirectionLTR);
+
+    float parentX = 0;
+    float parentY = 0;
+
+    Element* parent = getParent();
+    if (parent != nullptr) {
+        Rect parentBounds = parent->getAbsoluteBounds();
+        parentX = parentBounds.x + YGNodeLayoutGetPadding(parent->yogaNode, YGEdgeLeft);
+        parentY = parentBounds.y + YGNodeLayoutGetPadding(parent->yogaNode, YGEdgeTop);
+    }
+
+    updateAbsoluteBounds(parentX, parentY);
+    treeVersion++;
+}
+
+bool Element::isLayoutDirty() const {
+    return YGNodeIsDirty(yogaNode);
+}
+
+void Element::updateAbsoluteBounds(float parentX, float parentY) {
+    absoluteBounds = Rect(
+        parentX + YGNodeLayoutGetLeft(yogaNode),
+        parentY + YGNodeLayoutGetTop(yogaNode),
+        YGNodeLayoutGetWidth(yogaNode),
+        YGNodeLayoutGetHeight(yogaNode));
+
+    if (YGNodeGetHasNewLayout(yogaNode)) {
+        YGNodeSetHasNewLayout(yogaNode, false);
+        markDirty();
+    }
+
+    float childX = absoluteBounds.x + YGNodeLayoutGetPadding(yogaNode, YGEdgeLeft);
+    float childY = absoluteBounds.y + YGNodeLayoutGetPadding(yogaNode, YGEdgeTop);
+
+    for (auto& child : children) {
+        child->updateAbsoluteBounds(childX, childY);
+    }
 }
 
 void Element::draw() {
     if (!visible) return;
     
+    if (cached) {
+        drawCached();
+    } else {
+        drawBackground();
+        drawContent();
+        drawChildren();
+    }
+    
+    dirty = false;
+}
+
+void Element::drawCached() {
+    Rect bounds = getAbsoluteBounds();
+    float devicePixelRatio = Renderer::getDevicePixelRatio();
+
+    if (!layer || layer->size != bounds.toSize() || layer->devicePixelRatio != devicePixelRatio) {
+        layer = std::make_shared<Layer>(bounds.toSize(), devicePixelRatio);
+        dirty = true;
+    }
+
+    if (!dirty && layer->valid) {
+        Renderer::drawLayer(layer, bounds);
+        return;
+    }
+
     drawBackground();
     drawContent();
     drawChildren();
+
+    Renderer::renderLayer(layer, [this, bounds]() {
+        Renderer::translate(Point(-bounds.x, -bounds.y));
+        drawBackground();
+        drawContent();
+        drawChildren();
+    });
 }
 
 void Element::update() {
     updateMoveAnimation();
     if (!visible) return;
     
+    if (spriteAnimation || moving) {
+        markDirty();
+    }
+    
     for (auto& child : children) {
         child->update();
     }
@@ -236,11 +328,13 @@ void Element::drawBackground() {
                 Renderer::drawTexture(texture, bounds);
             }
         } else if (color.alpha > 0) {
-            if (cornerRadius > 0) {
-                Renderer::drawRoundedRect(bounds, cornerRadius, color);
-            } else {
-                Renderer::drawRect(bounds, color);
+            Size size = bounds.toSize();
+            if (!backgroundShape || backgroundShapeSize != size || backgroundShapeRadius != cornerRadius) {
+                backgroundShape = Renderer::createRoundedRectShape(size, cornerRadius);
+                backgroundShapeSize = size;
+                backgroundShapeRadius = cornerRadius;
             }
+            Renderer::drawShape(backgroundShape, bounds.toPoint(), color);
         }
     }
 }
@@ -255,29 +349,35 @@ void Element::drawChildren() {
 
 void Element::setColor(Color color) {
     this->color = color;
+    markDirty();
 }
 
 void Element::setTexture(std::shared_ptr<Texture> texture) {
     this->texture = texture;
+    markDirty();
 }
 
 void Element::setSprite(std::shared_ptr<Sprite> sprite, int index) {
     this->sprite = sprite;
     this->spriteIndex = index;
+    markDirty();
 }
 
 void Element::setSpriteAnimation(std::shared_ptr<SpriteAnimation> spriteAnimation) {
     this->spriteAnimation = spriteAnimation;
+    markDirty();
 }
 
 void Element::setCornerRadius(float radius) {
     this->cornerRadius = radius;
+    markDirty();
 }
 
-void Element::setMoveAnimation(float moveX, float moveY, Easing easing) {
-    moveAnimX = Animation(500.0f, moveX, 0.0f, easing);
-    moveAnimY = Animation(500.0f, moveY, 0.0f, easing);
+void Element::setMoveAnimation(float moveX, float moveY, Easing easing, float duration) {
+    moveAnimX = Animation(duration, moveX, 0.0f, easing);
+    moveAnimY = Animation(duration, moveY, 0.0f, easing);
     moving = true;
+    markDirty();
 }
 
 void Element::updateMoveAnimation() {
@@ -311,26 +411,7 @@ Rect Element::getBounds() const {
 }
 
 Rect Element::getAbsoluteBounds() const {
-    float x = 0;
-    float y = 0;
-    float width = YGNodeLayoutGetWidth(yogaNode);
-    float height = YGNodeLayoutGetHeight(yogaNode);
-    
-    YGNodeRef currentNode = yogaNode;
-    while (currentNode != nullptr) {
-        x += YGNodeLayoutGetLeft(currentNode);
-        y += YGNodeLayoutGetTop(currentNode);
-        
-        YGNodeRef parent = YGNodeGetParent(currentNode);
-        if (parent != nullptr) {
-            x += YGNodeLayoutGetPadding(parent, YGEdgeLeft);
-            y += YGNodeLayoutGetPadding(parent, YGEdgeTop);
-        }
-        
-        currentNode = parent;
-    }
-    
-    return Rect(x, y, width, height);
+    return absoluteBounds;
 }
 
 std::shared_ptr<Element> Element::getChild(size_t index) const {
@@ -350,12 +431,42 @@ const std::vector<std::shared_ptr<Element>>& Element::getChildren() const {
 
 void Element::setVisible(bool visible) {
     this->visible = visible;
+    treeVersion++;
+    markDirty();
 }
 
 bool Element::isVisible() const {
     return visible;
 }
 
+void Element::setCached(bool cached) {
+    this->cached = cached;
+    if (!cached && layer) {
+        Renderer::cancelLayer(layer);
+        layer = nullptr;
+    }
+    markDirty();
+}
+
+bool Element::isCached() const {
+    return cached;
+}
+
+void Element::markDirty() {
+    for (Element* element = this; element != nullptr; element = element->getParent()) {
+        element->dirty = true;
+    }
+}
+
+bool Element::isDirty() const {
+    return dirty;
+}
+
+Element* Element::getParent() const {
+    YGNodeRef parent = YGNodeGetParent(yogaNode);
+    return parent ? static_cast<Element*>(YGNodeGetContext(parent)) : nullptr;
+}
+
 bool Element::handleMousePressed(Point point, int button) {
     if (!visible) return false;
 
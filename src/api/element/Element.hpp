@@ -13,6 +13,8 @@
 class Texture;
 class Sprite;
 class SpriteAnimation;
+class Shape;
+class Layer;
 
 class Element {
     public:
@@ -73,6 +75,8 @@ class Element {
             Absolute
         };
 
+        static constexpr float DefaultMoveDuration = 500.0f;
+
         Element();
         virtual ~Element();
 
@@ -117,6 +121,7 @@ class Element {
         void setFillHeight();
         
         void calculateLayout(float parentWidth = YGUndefined, float parentHeight = YGUndefined);
+        bool isLayoutDirty() const;
         
         virtual void draw();
         virtual void update();
@@ -135,6 +140,12 @@ class Element {
         void setVisible(bool visible);
         bool isVisible() const;
         
+        void setCached(bool cached);
+        bool isCached() const;
+        void markDirty();
+        bool isDirty() const;
+        Element* getParent() const;
+        
         YGNodeRef getYogaNode() const { return yogaNode; }
 
         virtual bool handleMousePressed(Point point, int button);
@@ -158,7 +169,7 @@ class Element {
         static YGWrap toYGWrap(FlexWrap wrap);
         static YGPositionType toYGPositionType(PositionType position);
 
-        void setMoveAnimation(float moveX, float moveY, Easing easing);
+        void setMoveAnimation(float moveX, float moveY, Easing easing, float duration = DefaultMoveDuration);
         void updateMoveAnimation();
 
     protected:
@@ -176,6 +187,17 @@ class Element {
         float cornerRadius;
         bool visible;
         
+        std::shared_ptr<Shape> backgroundShape;
+        Size backgroundShapeSize;
+        float backgroundShapeRadius = 0.0f;
+        
+        Rect absoluteBounds;
+        static inline unsigned int treeVersion = 0;
+        
+        bool cached = false;
+        bool dirty = true;
+        std::shared_ptr<Layer> layer;
+        
         Animation moveAnimX, moveAnimY;
         bool moving = false;
         
@@ -184,4 +206,6 @@ class Element {
         virtual void drawBackground();
         virtual void drawContent();
         virtual void drawChildren();
+        void drawCached();
+        void updateAbsoluteBounds(float parentX, float parentY);
 };
@@ -1,4 +1,6 @@
 #include "RootElement.hpp"
+#include <algorithm>
+#include <cmath>
 
 RootElement::RootElement(float screenWidth, float screenHeight) 
     : screenWidth(screenWidth), screenHeight(screenHeight) {
@@ -13,10 +15,107 @@ void RootElement::resize(float width, float height) {
 }
 
 void RootElement::updateLayout() {
-    calculateLayout(screenWidth, screenHeight);
+    if (isLayoutDirty()) {
+        calculateLayout(screenWidth, screenHeight);
+    }
 }
 
 void RootElement::draw() {
+    updateLayout();
     Element::update();
+    updateLayout();
     Element::draw();
+}
+
+Element* RootElement::hitTest(Point point) {
+    updateLayout();
+
+    if (!hitTestValid || hitTestVersion != treeVersion) {
+        rebuildHitTestIndex();
+    }
+
+    const auto& cell = hitCells[getHitRow(point.y) * hitColumns + getHitColumn(point.x)];
+    for (auto it = cell.rbegin(); it != cell.rend(); ++it) {
+        const HitEntry& entry = hitEntries[*it];
+        if (point.isInside(entry.bounds)) {
+            return entry.element;
+        }
+    }
+
+    return nullptr;
+}
+
+bool RootElement::handleMousePressed(Point point, int button) {
+    Element* element = hitTest(point);
+    if (element == nullptr) return false;
+
+    element->onMousePressed(point, button);
+    return true;
+}
+
+bool RootElement::handleMouseReleased(Point point, int button) {
+    Element* element = hitTest(point);
+    if (element == nullptr) return false;
+
+    element->onMouseReleased(point, button);
+    return true;
+}
+
+bool RootElement::handleMouseMoved(Point point) {
+    Element* element = hitTest(point);
+    if (element == nullptr) return false;
+
+    element->onMouseMoved(point);
+    return true;
+}
+
+void RootElement::rebuildHitTestIndex() {
+    hitEntries.clear();
+    collectHitEntries(this);
+
+    hitArea = absoluteBounds;
+    hitColumns = std::clamp(static_cast<int>(std::ceil(hitArea.width / HitCellSize)), 1, MaxHitCells);
+    hitRows = std::clamp(static_cast<int>(std::ceil(hitArea.height / HitCellSize)), 1, MaxHitCells);
+
+    hitCells.resize(hitColumns * hitRows);
+    for (auto& cell : hitCells) {
+        cell.clear();
+    }
+
+    for (int i = 0; i < static_cast<int>(hitEntries.size()); i++) {
+        const Rect& bounds = hitEntries[i].bounds;
+        int minColumn = getHitColumn(bounds.x);
+        int maxColumn = getHitColumn(bounds.x + bounds.width);
+        int minRow = getHitRow(bounds.y);
+        int maxRow = getHitRow(bounds.y + bounds.height);
+
+        for (int row = minRow; row <= maxRow; row++) {
+            for (int column = minColumn; column <= maxColumn; column++) {
+                hitCells[row * hitColumns + column].push_back(i);
+            }
+        }
+    }
+
+    hitTestVersion = treeVersion;
+    hitTestValid = true;
+}
+
+void RootElement::collectHitEntries(Element* element) {
+    if (!element->isVisible()) return;
+
+    hitEntries.push_back({ element, element->getAbsoluteBounds() });
+
+    for (auto& child : element->getChildren()) {
+        collectHitEntries(child.get());
+    }
+}
+
+int RootElement::getHitColumn(float x) const {
+    float cellWidth = hitArea.width > 0 ? hitArea.width / hitColumns : HitCellSize;
+    return std::clamp(static_cast<int>(std::floor((x - hitArea.x) / cellWidth)), 0, hitColumns - 1);
+}
+
+int RootElement::getHitRow(float y) const {
+    float cellHeight = hitArea.height > 0 ? hitArea.height / hitRows : HitCellSize;
+    return std::clamp(static_cast<int>(std::floor((y - hitArea.y) / cellHeight)), 0, hitRows - 1);
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "Element.hpp"
 #include "../Point.hpp"
 #include <memory>
+#include <vector>
 
 class RootElement : public Element, public std::enable_shared_from_this<RootElement> {
 
@@ -13,9 +14,36 @@ class RootElement : public Element, public std::enable_shared_from_this<RootElem
         void updateLayout();
 
         void draw() override;
+
+        Element* hitTest(Point point);
+
+        bool handleMousePressed(Point point, int button) override;
+        bool handleMouseReleased(Point point, int button) override;
+        bool handleMouseMoved(Point point) override;
         
     private:
+        struct HitEntry {
+            Element* element;
+            Rect bounds;
+        };
+
+        static constexpr float HitCellSize = 64.0f;
+        static constexpr int MaxHitCells = 256;
+
         float screenWidth;
         float screenHeight;
         Point lastMousePosition;
-};
+
+        std::vector<HitEntry> hitEntries;
+        std::vector<std::vector<int>> hitCells;
+        Rect hitArea;
+        int hitColumns = 0;
+        int hitRows = 0;
+        unsigned int hitTestVersion = 0;
+        bool hitTestValid = false;
+
+        void rebuildHitTestIndex();
+        void collectHitEntries(Element* element);
+        int getHitColumn(float x) const;
+        int getHitRow(float y) const;
+};
\ No newline at end of file
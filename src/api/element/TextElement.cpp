@@ -12,6 +12,7 @@ std::string TextElement::getText() const {
 void TextElement::setText(const std::string& newText) {
     text = newText;
     updateFontBounds();
+    markDirty();
 }
 
 std::shared_ptr<Font> TextElement::getFont() const {
@@ -25,6 +26,7 @@ float TextElement::getFontSize() const {
 void TextElement::setFontSize(float size) {
     fontSize = size;
     updateFontBounds();
+    markDirty();
 }
 
 Color TextElement::getFontColor() const {
@@ -33,18 +35,59 @@ Color TextElement::getFontColor() const {
 
 void TextElement::setFontColor(const Color& color) {
     fontColor = color;
+    layout.setText(text, font, fontSize, fontColor);
+    markDirty();
+}
+
+void TextElement::setSpans(const std::vector<TextSpan>& spans) {
+    layout.setSpans(spans);
+    updateLayout();
+    markDirty();
+}
+
+const std::vector<TextSpan>& TextElement::getSpans() const {
+    return layout.getSpans();
+}
+
+void TextElement::setTextAlignment(TextLayout::Alignment alignment) {
+    layout.setAlignment(alignment);
+    markDirty();
+}
+
+void TextElement::setWrap(bool wrap) {
+    layout.setWrap(wrap);
+    updateLayout();
+    markDirty();
+}
+
+void TextElement::setMaxLines(int maxLines) {
+    layout.setMaxLines(maxLines);
+    updateLayout();
+    markDirty();
+}
+
+void TextElement::setEllipsis(bool ellipsis) {
+    layout.setEllipsis(ellipsis);
+    updateLayout();
+    markDirty();
 }
 
 void TextElement::drawContent() {
-    if(font) {
-        Rect bounds = getAbsoluteBounds();
-        Renderer::drawCenteredText(text, Point(bounds.x + bounds.width / 2, bounds.y), font, fontColor, fontSize);
-    }
+    Rect bounds = getAbsoluteBounds();
+    layout.draw(Point(bounds.x, bounds.y), bounds.width, bounds.width + WrapTolerance);
 }
 
 void TextElement::updateFontBounds() {
-    if(font) {
-        Size bounds = Renderer::getTextSize(text, font, fontSize);
-        setSize(bounds.width, bounds.height);
-    }
+    layout.setText(text, font, fontSize, fontColor);
+    updateLayout();
+}
+
+void TextElement::updateLayout() {
+    YGNodeMarkDirty(yogaNode);
+}
+
+YGSize TextElement::measure(YGNodeConstRef node, float width, YGMeasureMode widthMode, float height, YGMeasureMode heightMode) {
+    auto* element = static_cast<TextElement*>(YGNodeGetContext(node));
+    Size size = element->layout.measure(widthMode == YGMeasureModeUndefined ? YGUndefined : width);
+    return { size.width, size.height };
 }
\ No newline at end of file
@@ -1,9 +1,11 @@
 ﻿#pragma once
 #include "Element.hpp"
 #include "Font.hpp"
+#include "TextLayout.hpp"
 #include "api/Color.hpp"
 #include <memory>
 #include <string>
+#include <vector>
 
 class TextElement : public Element  {
 
@@ -12,13 +14,18 @@ class TextElement : public Element  {
         std::shared_ptr<Font> font;
         float fontSize;
         Color fontColor;
+        TextLayout layout;
 
     public:
         TextElement(const std::string& text, std::shared_ptr<Font> font, float fontSize, const Color& color)
             : Element(), text(text), font(font), fontSize(fontSize), fontColor(color) {
+                YGNodeSetMeasureFunc(yogaNode, &TextElement::measure);
+                YGNodeSetNodeType(yogaNode, YGNodeTypeText);
+                layout.setAlignment(TextLayout::Alignment::Center);
                 updateFontBounds();
             }
 
+        // setText, setFontSize and setFontColor replace any spans set through setSpans
         std::string getText() const;
         void setText(const std::string& newText);
         std::shared_ptr<Font> getFont() const;
@@ -27,8 +34,20 @@ class TextElement : public Element  {
         Color getFontColor() const;
         void setFontColor(const Color& color);
 
+        void setSpans(const std::vector<TextSpan>& spans);
+        const std::vector<TextSpan>& getSpans() const;
+        void setTextAlignment(TextLayout::Alignment alignment);
+        void setWrap(bool wrap);
+        void setMaxLines(int maxLines);
+        void setEllipsis(bool ellipsis);
+
         void drawContent() override;
 
     private:
+        static constexpr float WrapTolerance = 0.5f;
+
         void updateFontBounds();
+        void updateLayout();
+
+        static YGSize measure(YGNodeConstRef node, float width, YGMeasureMode widthMode, float height, YGMeasureMode heightMode);
 };
\ No newline at end of file